@@ -0,0 +1,575 @@
+/**
+ * @file lariat_bench.cpp
+ * @brief Compares Lariat at several node sizes against std::vector, std::deque and
+ *        std::list, for int and std::string values. Every benchmark reports items per
+ *        second so the containers line up in the output.
+ *
+ *        ./lariat_bench --benchmark_filter='random_index<.*int'
+ *
+ * @date 10-14-2026
+ */
+
+#include "lariat.h"
+#include "lariat_queue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <deque>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // values that compare and copy like real data
+    template<typename T>
+    T make_value(int i);
+
+    template<>
+    int make_value<int>(int i)
+    {
+        return i;
+    }
+
+    template<>
+    std::string make_value<std::string>(int i)
+    {
+        // long enough to not fit the small string buffer
+        return "value number " + std::to_string(i) + " of the benchmark";
+    }
+
+    // a value none of the containers hold, find has to scan everything
+    template<typename T>
+    T missing_value()
+    {
+        return make_value<T>(-1);
+    }
+
+    // the same indexes for every container
+    std::vector<int> random_indexes(int count, int range)
+    {
+        std::mt19937 rng(12345);
+        std::vector<int> indexes(count);
+
+        for(int& index : indexes)
+        {
+            index = static_cast<int>(rng() % range);
+        }
+
+        return indexes;
+    }
+
+    // the operations that differ between the containers
+    template<typename C>
+    void push_front_value(C& c, const typename C::value_type& value)
+    {
+        c.push_front(value);
+    }
+
+    template<typename T>
+    void push_front_value(std::vector<T>& c, const T& value)
+    {
+        c.insert(c.begin(), value);
+    }
+
+    template<typename C>
+    void insert_at(C& c, int index, const typename C::value_type& value)
+    {
+        c.insert(std::next(c.begin(), index), value);
+    }
+
+    template<typename T, int Size>
+    void insert_at(Lariat<T, Size>& c, int index, const T& value)
+    {
+        c.insert(index, value);
+    }
+
+    template<typename C>
+    void erase_at(C& c, int index)
+    {
+        c.erase(std::next(c.begin(), index));
+    }
+
+    template<typename T, int Size>
+    void erase_at(Lariat<T, Size>& c, int index)
+    {
+        c.erase(index);
+    }
+
+    template<typename C>
+    void push_back_value(C& c, const typename C::value_type& value)
+    {
+        c.push_back(value);
+    }
+
+    template<typename T, int Size>
+    void push_back_value(LariatQueue<T, Size>& c, const T& value)
+    {
+        c.push(value);
+    }
+
+    template<typename C>
+    void pop_front_value(C& c, typename C::value_type& value)
+    {
+        value = std::move(c.front());
+        c.pop_front();
+    }
+
+    template<typename T, int Size>
+    void pop_front_value(Lariat<T, Size>& c, T& value)
+    {
+        value = std::move(c.first());
+        c.pop_front();
+    }
+
+    template<typename T, int Size>
+    void pop_front_value(LariatQueue<T, Size>& c, T& value)
+    {
+        c.try_pop(value);
+    }
+
+    template<typename C>
+    size_t find_index(const C& c, const typename C::value_type& value)
+    {
+        return std::distance(c.begin(), std::find(c.begin(), c.end(), value));
+    }
+
+    template<typename T, int Size>
+    size_t find_index(const Lariat<T, Size>& c, const T& value)
+    {
+        return c.find(value);
+    }
+
+    template<typename C>
+    size_t lower_bound_index(const C& c, const typename C::value_type& value)
+    {
+        return std::distance(c.begin(), std::lower_bound(c.begin(), c.end(), value));
+    }
+
+    template<typename T, int Size>
+    size_t lower_bound_index(const Lariat<T, Size>& c, const T& value)
+    {
+        return c.lower_bound(value);
+    }
+
+    template<typename C>
+    void insert_sorted_value(C& c, const typename C::value_type& value)
+    {
+        c.insert(std::upper_bound(c.begin(), c.end(), value), value);
+    }
+
+    template<typename T, int Size>
+    void insert_sorted_value(Lariat<T, Size>& c, const T& value)
+    {
+        c.insert_sorted(value);
+    }
+
+    template<typename C, typename Predicate>
+    void erase_matching(C& c, Predicate pred)
+    {
+        c.erase(std::remove_if(c.begin(), c.end(), pred), c.end());
+    }
+
+    template<typename T, typename Predicate>
+    void erase_matching(std::list<T>& c, Predicate pred)
+    {
+        c.remove_if(pred);
+    }
+
+    template<typename T, int Size, typename Predicate>
+    void erase_matching(Lariat<T, Size>& c, Predicate pred)
+    {
+        c.erase_if(pred);
+    }
+
+    template<typename C>
+    C make_container(int count)
+    {
+        C c;
+
+        for(int i = 0; i < count; ++i)
+        {
+            c.push_back(make_value<typename C::value_type>(i));
+        }
+
+        return c;
+    }
+
+    template<typename C>
+    void push_back(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        for(auto _ : state)
+        {
+            C c;
+
+            for(int i = 0; i < count; ++i)
+            {
+                c.push_back(make_value<typename C::value_type>(i));
+            }
+
+            benchmark::DoNotOptimize(c);
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    // like push_back, with each value constructed straight in the free slots of the tail
+    template<typename C>
+    void appender(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        for(auto _ : state)
+        {
+            C c;
+
+            {
+                typename C::Appender appender = c.appender();
+
+                for(int i = 0; i < count; )
+                {
+                    int room = 0;
+                    typename C::value_type* slots = appender.window(room);
+                    int written = std::min(room, count - i);
+
+                    for(int j = 0; j < written; ++j)
+                    {
+                        new (slots + j) typename C::value_type(make_value<typename C::value_type>(i++));
+                    }
+
+                    appender.commit(written);
+                }
+            }
+
+            benchmark::DoNotOptimize(c);
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    // builds the container from a range of known length
+    template<typename C>
+    void construct_range(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        std::vector<typename C::value_type> values;
+
+        for(int i = 0; i < count; ++i)
+        {
+            values.push_back(make_value<typename C::value_type>(i));
+        }
+
+        for(auto _ : state)
+        {
+            C c(values.begin(), values.end());
+
+            benchmark::DoNotOptimize(c);
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template<typename C>
+    void push_front(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        for(auto _ : state)
+        {
+            C c;
+
+            for(int i = 0; i < count; ++i)
+            {
+                push_front_value(c, make_value<typename C::value_type>(i));
+            }
+
+            benchmark::DoNotOptimize(c);
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    // an insert and an erase at random positions per item, so the size stays the same
+    template<typename C>
+    void random_insert_erase(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+        const int operations = 1024;
+
+        C c = make_container<C>(count);
+
+        std::vector<int> inserts = random_indexes(operations, count + 1);
+        std::vector<int> erases = random_indexes(operations, count);
+
+        typename C::value_type value = make_value<typename C::value_type>(7);
+
+        for(auto _ : state)
+        {
+            for(int i = 0; i < operations; ++i)
+            {
+                insert_at(c, inserts[i], value);
+                erase_at(c, erases[i]);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * operations);
+    }
+
+    template<typename C>
+    void sequential_index(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        C c = make_container<C>(count);
+
+        for(auto _ : state)
+        {
+            for(int i = 0; i < count; ++i)
+            {
+                benchmark::DoNotOptimize(c[i]);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template<typename C>
+    void random_index(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        C c = make_container<C>(count);
+
+        std::vector<int> indexes = random_indexes(count, count);
+
+        for(auto _ : state)
+        {
+            for(int index : indexes)
+            {
+                benchmark::DoNotOptimize(c[index]);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template<typename C>
+    void find(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        C c = make_container<C>(count);
+
+        typename C::value_type missing = missing_value<typename C::value_type>();
+
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(find_index(c, missing));
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template<typename C>
+    void copy(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        C c = make_container<C>(count);
+
+        for(auto _ : state)
+        {
+            C copy(c);
+
+            benchmark::DoNotOptimize(copy);
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    // looks up random values in a sorted container
+    template<typename C>
+    void lower_bound(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        C c = make_container<C>(count);
+
+        std::vector<typename C::value_type> values;
+
+        for(int index : random_indexes(count, count))
+        {
+            values.push_back(make_value<typename C::value_type>(index));
+        }
+
+        std::sort(c.begin(), c.end());
+
+        for(auto _ : state)
+        {
+            for(const auto& value : values)
+            {
+                benchmark::DoNotOptimize(lower_bound_index(c, value));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    // builds a sorted container from values in random order
+    template<typename C>
+    void insert_sorted(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        std::vector<typename C::value_type> values;
+
+        for(int index : random_indexes(count, count))
+        {
+            values.push_back(make_value<typename C::value_type>(index));
+        }
+
+        for(auto _ : state)
+        {
+            C c;
+
+            for(const auto& value : values)
+            {
+                insert_sorted_value(c, value);
+            }
+
+            benchmark::DoNotOptimize(c);
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    // a push at the back and a pop at the front per item, through a queue holding count values
+    template<typename C>
+    void fifo(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+        const int operations = 1024;
+
+        C c;
+
+        for(int i = 0; i < count; ++i)
+        {
+            push_back_value(c, make_value<typename C::value_type>(i));
+        }
+
+        typename C::value_type value = make_value<typename C::value_type>(7);
+
+        for(auto _ : state)
+        {
+            for(int i = 0; i < operations; ++i)
+            {
+                push_back_value(c, value);
+                pop_front_value(c, value);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * operations);
+    }
+
+    // erases every third value
+    template<typename C>
+    void erase_if(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        for(auto _ : state)
+        {
+            state.PauseTiming();
+
+            C c = make_container<C>(count);
+            int seen = 0;
+
+            state.ResumeTiming();
+
+            erase_matching(c, [&](const typename C::value_type&) { return seen++ % 3 == 0; });
+
+            benchmark::DoNotOptimize(c);
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    // compacts a list that random erases left about half full
+    template<typename C>
+    void compact(benchmark::State& state)
+    {
+        const int count = static_cast<int>(state.range(0));
+
+        for(auto _ : state)
+        {
+            state.PauseTiming();
+
+            C c = make_container<C>(count * 2);
+
+            for(int index : random_indexes(count, count))
+            {
+                c.erase(index);
+            }
+
+            state.ResumeTiming();
+
+            c.compact();
+
+            benchmark::DoNotOptimize(c);
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+}
+
+// every container, random access containers only, and lariats only. The dynamic size
+// lariat has a page of values per node
+#define LARIAT_BENCH_LARIATS(bench, T, args)                     \
+    BENCHMARK_TEMPLATE(bench, Lariat<T, 16>) args;               \
+    BENCHMARK_TEMPLATE(bench, Lariat<T, 64>) args;               \
+    BENCHMARK_TEMPLATE(bench, Lariat<T, 256>) args;              \
+    BENCHMARK_TEMPLATE(bench, Lariat<T, 1024>) args;             \
+    BENCHMARK_TEMPLATE(bench, Lariat<T, LARIAT_DYNAMIC_SIZE>) args
+
+#define LARIAT_BENCH_RANDOM_ACCESS(bench, T, args)               \
+    BENCHMARK_TEMPLATE(bench, std::vector<T>) args;              \
+    BENCHMARK_TEMPLATE(bench, std::deque<T>) args;               \
+    LARIAT_BENCH_LARIATS(bench, T, args)
+
+#define LARIAT_BENCH_ALL(bench, T, args)                         \
+    BENCHMARK_TEMPLATE(bench, std::list<T>) args;                \
+    LARIAT_BENCH_RANDOM_ACCESS(bench, T, args)
+
+#define LARIAT_BENCH_QUEUES(bench, T, args)                      \
+    BENCHMARK_TEMPLATE(bench, std::deque<T>) args;               \
+    BENCHMARK_TEMPLATE(bench, std::list<T>) args;                \
+    BENCHMARK_TEMPLATE(bench, Lariat<T, 64>) args;               \
+    BENCHMARK_TEMPLATE(bench, Lariat<T, 256>) args;              \
+    BENCHMARK_TEMPLATE(bench, LariatQueue<T, 64>) args;          \
+    BENCHMARK_TEMPLATE(bench, LariatQueue<T, 256>) args
+
+#define LARIAT_BENCH_TYPE(T)                                                \
+    LARIAT_BENCH_ALL(push_back, T, ->Arg(1 << 16));                         \
+    LARIAT_BENCH_LARIATS(appender, T, ->Arg(1 << 16));                      \
+    LARIAT_BENCH_ALL(construct_range, T, ->Arg(1 << 16));                   \
+    LARIAT_BENCH_ALL(push_front, T, ->Arg(1 << 12));                        \
+    LARIAT_BENCH_ALL(random_insert_erase, T, ->Arg(1 << 12)->Arg(1 << 16)); \
+    LARIAT_BENCH_RANDOM_ACCESS(sequential_index, T, ->Arg(1 << 16));        \
+    LARIAT_BENCH_RANDOM_ACCESS(random_index, T, ->Arg(1 << 16));            \
+    LARIAT_BENCH_ALL(find, T, ->Arg(1 << 16));                              \
+    LARIAT_BENCH_ALL(copy, T, ->Arg(1 << 16));                              \
+    LARIAT_BENCH_RANDOM_ACCESS(lower_bound, T, ->Arg(1 << 16));             \
+    LARIAT_BENCH_RANDOM_ACCESS(insert_sorted, T, ->Arg(1 << 14));           \
+    LARIAT_BENCH_QUEUES(fifo, T, ->Arg(1 << 12));                           \
+    LARIAT_BENCH_ALL(erase_if, T, ->Arg(1 << 16));                          \
+    LARIAT_BENCH_LARIATS(compact, T, ->Arg(1 << 16))
+
+LARIAT_BENCH_TYPE(int);
+LARIAT_BENCH_TYPE(std::string);
+
+BENCHMARK_MAIN();
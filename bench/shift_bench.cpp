@@ -0,0 +1,141 @@
+/**
+ * @file shift_bench.cpp
+ * @brief Microbenchmark for the in-node shifts. Compares the old swap based rotation
+ *        against the block move Lariat uses now, for the rotation alone and through
+ *        push_front/insert, which rotate a whole node on every call.
+ *
+ *        built by the shift_bench target, or by hand:
+ *        g++ -std=c++17 -O2 -I.. shift_bench.cpp -o shift_bench && ./shift_bench
+ *
+ * @date 10-14-2026
+ */
+
+#include "lariat.h"
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    // the rotation shiftUp used to do, one three assignment swap per position
+    template<typename T>
+    void swap_rotate(T* values, int localIndex, int count)
+    {
+        for(int i = localIndex + 1; i < count; ++i)
+        {
+            T temp = values[localIndex];
+            values[localIndex] = values[i];
+            values[i] = temp;
+        }
+    }
+
+    // the same rotation done the way the shifts work now, one block move
+    template<typename T>
+    void block_rotate(T* values, int localIndex, int count)
+    {
+        T temp = std::move(values[count - 1]);
+
+        if constexpr(std::is_trivially_copyable<T>::value)
+        {
+            std::memmove(static_cast<void*>(values + localIndex + 1), static_cast<const void*>(values + localIndex), sizeof(T) * (count - 1 - localIndex));
+        }
+        else
+        {
+            std::move_backward(values + localIndex, values + count - 1, values + count);
+        }
+
+        values[localIndex] = std::move(temp);
+    }
+
+    // keeps the optimizer from throwing away the work
+    template<typename T>
+    void keep(const T& value)
+    {
+        asm volatile("" : : "r"(&value) : "memory");
+    }
+
+    template<typename Function>
+    double time_ns(long iterations, Function function)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for(long i = 0; i < iterations; ++i)
+        {
+            function();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+
+    void report(const std::string& name, double before, double after)
+    {
+        std::cout << std::left << std::setw(40) << name
+                  << std::right << std::setw(12) << std::fixed << std::setprecision(1) << before << " ns"
+                  << std::setw(12) << after << " ns"
+                  << std::setw(9) << std::setprecision(2) << before / after << "x\n";
+    }
+
+    template<typename T, int Size>
+    void bench_rotation(const std::string& name)
+    {
+        static T values[Size] = {};
+        long iterations = 200000000L / Size;
+
+        double before = time_ns(iterations, [&]{ swap_rotate(values, 0, Size); keep(values[0]); });
+        double after  = time_ns(iterations, [&]{ block_rotate(values, 0, Size); keep(values[0]); });
+
+        report(name, before, after);
+    }
+
+    // push_front into a non-full head rotates the whole head, time how long filling one takes
+    template<int Size>
+    void bench_push_front()
+    {
+        const long rounds = 20000000L / Size;
+
+        auto start = std::chrono::steady_clock::now();
+
+        for(long round = 0; round < rounds / Size + 1; ++round)
+        {
+            Lariat<int, Size> list;
+
+            for(int i = 0; i < Size; ++i)
+            {
+                list.push_front(i);
+            }
+
+            keep(list.first());
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        double perPush = std::chrono::duration<double, std::nano>(end - start).count() / ((rounds / Size + 1) * Size);
+
+        std::cout << std::left << std::setw(40) << ("Lariat<int, " + std::to_string(Size) + ">::push_front")
+                  << std::right << std::setw(27) << std::fixed << std::setprecision(1) << perPush << " ns\n";
+    }
+}
+
+int main()
+{
+    std::cout << std::left << std::setw(40) << "rotate whole node"
+              << std::right << std::setw(15) << "swap loop" << std::setw(15) << "block move" << std::setw(10) << "gain" << "\n";
+
+    bench_rotation<int, 512>("int, Size 512");
+    bench_rotation<int, 4096>("int, Size 4096");
+    bench_rotation<double, 512>("double, Size 512");
+    bench_rotation<double, 4096>("double, Size 4096");
+    bench_rotation<std::string, 512>("std::string, Size 512");
+
+    std::cout << "\n";
+
+    bench_push_front<512>();
+    bench_push_front<4096>();
+
+    return 0;
+}
@@ -0,0 +1,586 @@
+/**
+ * @file concurrent_lariat.cpp
+ * @brief ConcurrentLariat is a lariat that many threads can use at once. Every node has
+ *        its own reader/writer lock, and operations walk the chain hand over hand, so
+ *        reads and in-node changes to different nodes run in parallel. Only compact and
+ *        clear stop the other threads.
+ *
+ * @date 10-14-2026
+ */
+
+/**
+ * @brief locks for reading, waits while a writer holds the lock or is waiting for it
+ */
+inline void LariatNodeLock::lock_shared()
+{
+    while(true)
+    {
+        int state = state_.load(std::memory_order_relaxed);
+
+        if((state & WRITERS) == 0 && state_.compare_exchange_weak(state, state + READER, std::memory_order_acquire))
+        {
+            return;
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief unlocks for reading
+ */
+inline void LariatNodeLock::unlock_shared()
+{
+    state_.fetch_sub(READER, std::memory_order_release);
+}
+
+/**
+ * @brief locks for writing, new readers wait from the moment this is called
+ */
+inline void LariatNodeLock::lock()
+{
+    state_.fetch_add(WAITING, std::memory_order_relaxed);
+
+    while(true)
+    {
+        int state = state_.load(std::memory_order_relaxed);
+
+        // no readers and no writer, only waiting writers
+        if((state & ~(WRITERS ^ WRITER)) == 0 && state_.compare_exchange_weak(state, state - WAITING + WRITER, std::memory_order_acquire))
+        {
+            return;
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief unlocks for writing
+ */
+inline void LariatNodeLock::unlock()
+{
+    state_.fetch_sub(WRITER, std::memory_order_release);
+}
+
+/**
+ * @brief Construct an empty concurrent lariat, the head node always exists
+ */
+template<typename T, int Size>
+ConcurrentLariat<T, Size>::ConcurrentLariat() : head_(allocate_node()), tail_(head_), size_(0)
+{
+
+}
+
+/**
+ * @brief Destroy the concurrent lariat, no other thread can be using it
+ */
+template<typename T, int Size>
+ConcurrentLariat<T, Size>::~ConcurrentLariat()
+{
+    CNode* walker = head_;
+
+    while(walker != nullptr)
+    {
+        CNode* next = walker->next;
+
+        delete_node(walker);
+
+        walker = next;
+    }
+}
+
+/**
+ * @brief inserts a copy of a value at the index
+ *
+ * @param index - index to insert at
+ * @param value - value to insert
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::insert(int index, const T& value)
+{
+    // copy before locking anything
+    insert(index, T(value));
+}
+
+/**
+ * @brief inserts a value at the index, moving from it
+ *
+ * @param index - index to insert at
+ * @param value - value to insert
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::insert(int index, T&& value)
+{
+    std::shared_lock<LariatNodeLock> structure(structure_);
+
+    WriteTarget target = lock_for_write(index, true);
+
+    put_in_node(target.node, target.localIndex, std::move(value));
+}
+
+/**
+ * @brief inserts a copy of a value at the end of the list
+ *
+ * @param value - value to insert
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::push_back(const T& value)
+{
+    push_back(T(value));
+}
+
+/**
+ * @brief inserts a value at the end of the list, moving from it. Goes straight to the
+ *        tail instead of walking the list, since it doesn't depend on any index.
+ *
+ * @param value - value to insert
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::push_back(T&& value)
+{
+    std::shared_lock<LariatNodeLock> structure(structure_);
+
+    CNode* node = tail_.load();
+    std::unique_lock<LariatNodeLock> lock(node->lock);
+
+    // another append could have split the tail before we locked it
+    while(node->next != nullptr)
+    {
+        CNode* next = node->next;
+        std::unique_lock<LariatNodeLock> nextLock(next->lock);
+
+        lock = std::move(nextLock);
+        node = next;
+    }
+
+    put_in_node(node, node->count, std::move(value));
+}
+
+/**
+ * @brief inserts a copy of a value at the front of the list
+ *
+ * @param value - value to insert
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::push_front(const T& value)
+{
+    insert(0, T(value));
+}
+
+/**
+ * @brief inserts a value at the front of the list, moving from it
+ *
+ * @param value - value to insert
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::push_front(T&& value)
+{
+    insert(0, std::move(value));
+}
+
+/**
+ * @brief erases the value at the index. An emptied node stays in the list until compact.
+ *
+ * @param index - index to erase
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::erase(int index)
+{
+    std::shared_lock<LariatNodeLock> structure(structure_);
+
+    WriteTarget target = lock_for_write(index, false);
+
+    CNode* node = target.node;
+
+    node->values[target.localIndex].~T();
+    Lariat<T, Size>::relocate_values(node->values + target.localIndex, node->values + target.localIndex + 1, node->count - target.localIndex - 1);
+
+    node->count--;
+    size_--;
+}
+
+/**
+ * @brief returns a copy of the value at the index
+ *
+ * @param index - index to read
+ */
+template<typename T, int Size>
+T ConcurrentLariat<T, Size>::get(int index) const
+{
+    std::shared_lock<LariatNodeLock> structure(structure_);
+
+    if(index < 0)
+    {
+        throw LariatException(LariatException::E_BAD_INDEX, "Subscript is out of range");
+    }
+
+    CNode* node = head_;
+    std::shared_lock<LariatNodeLock> lock(node->lock);
+    int base = 0;
+
+    // walk hand over hand until the node holding the index
+    while(index >= base + node->count)
+    {
+        CNode* next = node->next;
+
+        if(next == nullptr)
+        {
+            throw LariatException(LariatException::E_BAD_INDEX, "Subscript is out of range");
+        }
+
+        base += node->count;
+
+        std::shared_lock<LariatNodeLock> nextLock(next->lock);
+
+        lock = std::move(nextLock);
+        node = next;
+    }
+
+    return node->values[index - base];
+}
+
+/**
+ * @brief replaces the value at the index with a copy of a value
+ *
+ * @param index - index to write
+ * @param value - the new value
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::set(int index, const T& value)
+{
+    std::shared_lock<LariatNodeLock> structure(structure_);
+
+    WriteTarget target = lock_for_write(index, false);
+
+    target.node->values[target.localIndex] = value;
+}
+
+/**
+ * @brief returns the index of the first value equal to a value
+ *
+ * @param value - value to find
+ * @return - index of the value, or NOT_FOUND if not found. Writers can change the size
+ *           while the walk runs, so a miss isn't reported as a size
+ */
+template<typename T, int Size>
+unsigned ConcurrentLariat<T, Size>::find(const T& value) const
+{
+    std::shared_lock<LariatNodeLock> structure(structure_);
+
+    CNode* node = head_;
+    std::shared_lock<LariatNodeLock> lock(node->lock);
+    int base = 0;
+
+    while(true)
+    {
+        int localIndex = Lariat<T, Size>::find_in_values(node->values, node->count, value);
+
+        if(localIndex < node->count)
+        {
+            return base + localIndex;
+        }
+
+        base += node->count;
+
+        CNode* next = node->next;
+
+        if(next == nullptr)
+        {
+            return NOT_FOUND;
+        }
+
+        std::shared_lock<LariatNodeLock> nextLock(next->lock);
+
+        lock = std::move(nextLock);
+        node = next;
+    }
+}
+
+/**
+ * @brief returns the number of items in the list
+ */
+template<typename T, int Size>
+size_t ConcurrentLariat<T, Size>::size() const
+{
+    return size_.load();
+}
+
+/**
+ * @brief erases every value and deletes every node but the head
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::clear()
+{
+    std::unique_lock<LariatNodeLock> structure(structure_);
+
+    CNode* walker = head_->next;
+
+    while(walker != nullptr)
+    {
+        CNode* next = walker->next;
+
+        delete_node(walker);
+
+        walker = next;
+    }
+
+    for(int i = 0; i < head_->count; ++i)
+    {
+        head_->values[i].~T();
+    }
+
+    head_->count = 0;
+    head_->next = nullptr;
+
+    tail_ = head_;
+    size_ = 0;
+}
+
+/**
+ * @brief pushes the data to the front of the list reusing empty positions, and deletes the
+ *        nodes left empty, including the ones erases left behind. Waits for every other
+ *        operation since it moves values between nodes.
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::compact()
+{
+    std::unique_lock<LariatNodeLock> structure(structure_);
+
+    CNode* leftFoot = head_;
+    CNode* rightFoot = head_->next;
+
+    // skip the nodes that are already full
+    while(leftFoot->count == Size && rightFoot != nullptr)
+    {
+        leftFoot = leftFoot->next;
+        rightFoot = rightFoot->next;
+    }
+
+    while(rightFoot != nullptr)
+    {
+        int rightFootCount = rightFoot->count;
+        int moved = 0;
+
+        rightFoot->count = 0;
+
+        if(leftFoot->count == Size)
+        {
+            leftFoot = leftFoot->next;
+        }
+
+        while(moved < rightFootCount)
+        {
+            // move as many values from the right foot as fit in the left foot in one block
+            int block = Size - leftFoot->count;
+
+            if(block > rightFootCount - moved)
+            {
+                block = rightFootCount - moved;
+            }
+
+            T* destination = leftFoot->values + leftFoot->count;
+            T* source = rightFoot->values + moved;
+
+            if(destination != source)
+            {
+                Lariat<T, Size>::relocate_values(destination, source, block);
+            }
+
+            leftFoot->count += block;
+            moved += block;
+
+            if(leftFoot->count == Size)
+            {
+                leftFoot = leftFoot->next;
+            }
+        }
+
+        rightFoot = rightFoot->next;
+    }
+
+    // every node after the last one holding values is empty now
+    CNode* last = head_;
+
+    while(last->next != nullptr && last->next->count != 0)
+    {
+        last = last->next;
+    }
+
+    CNode* walker = last->next;
+
+    while(walker != nullptr)
+    {
+        CNode* next = walker->next;
+
+        delete_node(walker);
+
+        walker = next;
+    }
+
+    last->next = nullptr;
+    tail_ = last;
+}
+
+/**
+ * @brief walks the list hand over hand to the node holding the index, and locks it
+ *        exclusive. The walk holds nodes shared, so when it finds the node it has to
+ *        let go of it to lock it exclusive, and checks again that the index is still in it.
+ *        The caller must hold the structure lock shared.
+ *
+ * @param index - global index to find
+ * @param inserting - true if the index is an insert position, which can be one past the last value
+ * @return the node locked exclusive and the local index in it
+ */
+template<typename T, int Size>
+typename ConcurrentLariat<T, Size>::WriteTarget ConcurrentLariat<T, Size>::lock_for_write(int index, bool inserting)
+{
+    if(index < 0)
+    {
+        throw LariatException(LariatException::E_BAD_INDEX, "Subscript is out of range");
+    }
+
+    // an insert between two nodes goes in the first one if it has room
+    auto holds = [&](CNode* node, int base)
+    {
+        return index < base + node->count ||
+              (inserting && index == base + node->count && (node->count < Size || node->next == nullptr));
+    };
+
+    std::shared_lock<LariatNodeLock> previousLock;
+
+    CNode* node = head_;
+    std::shared_lock<LariatNodeLock> lock(node->lock);
+    int base = 0;
+
+    while(true)
+    {
+        if(holds(node, base))
+        {
+            // the previous node stays locked, so nothing behind us reaches this node first
+            lock.unlock();
+
+            std::unique_lock<LariatNodeLock> writeLock(node->lock);
+
+            if(holds(node, base))
+            {
+                return WriteTarget{ node, index - base, std::move(writeLock) };
+            }
+
+            // another thread changed the node in between, keep walking
+            writeLock.unlock();
+            lock.lock();
+
+            continue;
+        }
+
+        CNode* next = node->next;
+
+        if(next == nullptr)
+        {
+            throw LariatException(LariatException::E_BAD_INDEX, "Subscript is out of range");
+        }
+
+        base += node->count;
+
+        std::shared_lock<LariatNodeLock> nextLock(next->lock);
+
+        previousLock = std::move(lock);
+        lock = std::move(nextLock);
+        node = next;
+    }
+}
+
+/**
+ * @brief puts a value in a node that is locked exclusive. A full node gets split, except
+ *        when the value goes on its end, then the value starts a new node and nothing moves.
+ *        The new node is linked while the full node is locked, and only becomes the tail
+ *        once the value is in, so nothing can reach it until then.
+ *
+ * @param node - node to insert into, locked exclusive
+ * @param localIndex - index in the node to insert at
+ * @param value - value to insert
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::put_in_node(CNode* node, int localIndex, T&& value)
+{
+    CNode* newTail = nullptr;
+
+    if(node->count == Size)
+    {
+        CNode* splitNode = allocate_node();
+        int keep = Size;
+
+        // appending keeps the whole node, otherwise the upper half moves to the new node
+        if(localIndex < Size)
+        {
+            keep = Size / 2;
+
+            Lariat<T, Size>::relocate_values(splitNode->values, node->values + keep, Size - keep);
+
+            splitNode->count = Size - keep;
+            node->count = keep;
+        }
+
+        splitNode->next = node->next;
+        node->next = splitNode;
+
+        // push_back goes straight to the tail without the full node's lock, so it can't see
+        // the new node before this is done with it
+        if(splitNode->next == nullptr)
+        {
+            newTail = splitNode;
+        }
+
+        // the value goes in whichever node its position ended up in
+        if(localIndex > keep || localIndex == Size)
+        {
+            localIndex -= keep;
+            node = splitNode;
+        }
+    }
+
+    Lariat<T, Size>::relocate_values(node->values + localIndex + 1, node->values + localIndex, node->count - localIndex);
+
+    new (node->values + localIndex) T(std::move(value));
+
+    node->count++;
+    size_++;
+
+    if(newTail != nullptr)
+    {
+        tail_ = newTail;
+    }
+}
+
+/**
+ * @brief allocates an empty node
+ */
+template<typename T, int Size>
+typename ConcurrentLariat<T, Size>::CNode* ConcurrentLariat<T, Size>::allocate_node()
+{
+    try
+    {
+        return new CNode;
+    }
+    catch(const std::bad_alloc& e)
+    {
+        throw LariatException(LariatException::E_NO_MEMORY, e.what());
+    }
+}
+
+/**
+ * @brief destroys the values of a node and deletes it
+ *
+ * @param node - node to delete
+ */
+template<typename T, int Size>
+void ConcurrentLariat<T, Size>::delete_node(CNode* node)
+{
+    for(int i = 0; i < node->count; ++i)
+    {
+        node->values[i].~T();
+    }
+
+    delete node;
+}
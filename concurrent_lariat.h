@@ -0,0 +1,154 @@
+/**
+ * @file concurrent_lariat.h
+ * @brief ConcurrentLariat is a lariat that many threads can use at once. Every node has
+ *        its own reader/writer lock, and operations walk the chain hand over hand, so
+ *        reads and in-node changes to different nodes run in parallel. Only compact and
+ *        clear stop the other threads.
+ *
+ * @date 10-14-2026
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef CONCURRENT_LARIAT_H
+#define CONCURRENT_LARIAT_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>       // size, tail, lock state
+#include <limits>       // find miss sentinel
+#include <mutex>        // unique_lock
+#include <shared_mutex> // shared_lock
+#include <thread>       // yield while waiting for a lock
+
+#include "lariat.h" // LariatException, value moves
+
+/*
+ * A reader/writer spin lock that prefers writers. Once a writer is waiting, no new
+ * readers get in, so readers streaming through a node can't starve a writer the way
+ * they can with a reader preferring std::shared_mutex. Waits can't form a cycle since
+ * a walk only waits for the node ahead of the ones it holds.
+ */
+class LariatNodeLock
+{
+    public:
+        void lock_shared();
+        void unlock_shared();
+        void lock();
+        void unlock();
+
+    private:
+        enum
+        {
+            WRITER = 1,                   // a writer holds the lock
+            WAITING = 2,                  // each waiting writer adds one of these
+            READER = 1 << 16,             // each reader adds one of these
+            WRITERS = READER - 1          // the writer bit and the waiting writers
+        };
+
+        std::atomic<int> state_{0};
+};
+
+/*
+ * Locking:
+ *  - every operation holds structure_ shared, compact and clear hold it exclusive.
+ *  - a walk starts at head_ and locks the next node before it unlocks the current one,
+ *    so no operation passes another one on the way to its node.
+ *  - a node is read under its lock shared and changed under its lock exclusive.
+ *  - nodes are only deleted by compact and clear. An erase that empties a node leaves
+ *    the node in the chain, so a walk never has a node taken out from under it. A push_back
+ *    locks the tail without holding the node before it, so unlinking a node under the walk
+ *    locks alone could free a node a push is waiting on.
+ *  - a split links the new node while the full node is locked exclusive, so nothing
+ *    can reach the new node before it is ready.
+ *  - an index means the position when the operation passed the nodes before it.
+ *
+ * Empty nodes are only reused when an insert lands on them, so a workload that erases
+ * in one part of the list and inserts in another (a queue pushing the back and erasing
+ * the front, say) keeps growing the chain with empty nodes. Call compact() now and then to delete them.
+ */
+template <typename T, int Size>
+class ConcurrentLariat
+{
+    static_assert(Size > 0, "needs a fixed Size");
+
+    public:
+        // what find returns when no value is equal, a miss can't be told from a size that changed under it
+        static constexpr unsigned NOT_FOUND = std::numeric_limits<unsigned>::max();
+
+        ConcurrentLariat(); // default constructor
+        ~ConcurrentLariat(); // destructor
+
+        ConcurrentLariat(const ConcurrentLariat&) = delete;
+        ConcurrentLariat& operator=(const ConcurrentLariat&) = delete;
+
+        // inserts
+        void insert(int index, const T& value);
+        void insert(int index, T&& value);
+        void push_back(const T& value);
+        void push_back(T&& value);
+        void push_front(const T& value);
+        void push_front(T&& value);
+
+        // deletes
+        void erase(int index);
+
+        // access, values are copied since another thread can move them at any time
+        T    get(int index) const;
+        void set(int index, const T& value);
+
+        unsigned find(const T& value) const; // returns index, NOT_FOUND if not found
+
+        size_t size() const; // total number of items (not nodes)
+        void clear();        // make it empty, waits for every other operation
+
+        void compact();      // push data in front and delete the empty nodes, waits for every other operation
+
+    private:
+        struct CNode
+        {
+            CNode *next  = nullptr;
+            int    count = 0;                 // number of items currently in the node
+
+            mutable LariatNodeLock lock;      // shared to read the node, exclusive to change it
+
+            // values are raw storage, only the first count are constructed
+            union
+            {
+                T values[ Size ];
+            };
+
+            CNode() {}
+            ~CNode() {}
+        };
+
+        // a node locked exclusive for changing and the local index of the position in it
+        struct WriteTarget
+        {
+            CNode* node;
+            int localIndex;
+            std::unique_lock<LariatNodeLock> lock;
+        };
+
+        CNode *head_;                         // first node, lives as long as the list
+        std::atomic<CNode*> tail_;            // last node, appends walk forward from it if it was split
+        std::atomic<size_t> size_;            // the number of items (not nodes) in the list
+
+        mutable LariatNodeLock structure_;    // shared by every operation, exclusive for compact and clear
+
+    private:
+
+        // walks to the node holding the index and locks it exclusive.
+        WriteTarget lock_for_write(int index, bool inserting);
+
+        // puts a value in a node that is locked exclusive, splitting it if it is full.
+        void put_in_node(CNode* node, int localIndex, T&& value);
+
+        // allocates an empty node.
+        static CNode* allocate_node();
+
+        // destroys the values of a node and deletes it.
+        static void delete_node(CNode* node);
+};
+
+#include "concurrent_lariat.cpp"
+
+#endif // CONCURRENT_LARIAT_H
@@ -12,6 +12,10 @@
 
 #include <iostream>
 #include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <charconv>
+#include <locale>
 
 #if 1
 
@@ -24,18 +28,130 @@
 template <typename T, int Size>
 std::ostream& operator<<( std::ostream &os, Lariat<T, Size> const & list )
 {
-    typename Lariat<T, Size>::LNode * current  = list.head_;
+    list.dump(os, DUMP_NODES);
+
+    return os;
+}
+
+/**
+ * @brief erases every value of a list the predicate is true for, see Lariat::erase_if
+ * 
+ * @param list - list to erase from
+ * @param pred - returns true for the values to erase
+ * @return - the number of values erased
+ */
+template <typename T, int Size, typename Predicate>
+size_t erase_if(Lariat<T, Size>& list, Predicate pred)
+{
+    return list.erase_if(pred);
+}
+
+/**
+ * @brief writes the list to a stream, formatted into a buffer that is written in large
+ *        chunks instead of a write (or a flush) per value. Integers are formatted with
+ *        to_chars when the stream has the default integer flags and the classic locale,
+ *        everything else the way operator<< of the stream would, with the flags and the
+ *        locale of the stream.
+ * 
+ * @param os - stream to write to
+ * @param format - values only, or every node with its count and the index of each value
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::dump(std::ostream& os, LariatDumpFormat format) const
+{
+    const size_t chunkSize = 1 << 16;
+
+    std::string buffer;
+    buffer.reserve(chunkSize + 256);
+
+    // integers that print the same through to_chars as through the stream
+    constexpr bool plainInteger = std::is_integral<T>::value && sizeof(T) >= sizeof(short) && !std::is_same<T, wchar_t>::value && 
+                                  !std::is_same<T, char16_t>::value && !std::is_same<T, char32_t>::value;
+
+    // another locale can group the digits, to_chars never does
+    bool defaultFlags = (os.flags() & (std::ios::basefield | std::ios::showpos)) == std::ios::dec && os.width() == 0 &&
+                        os.getloc() == std::locale::classic();
+
+    // formats anything else with the flags and the locale of the stream
+    std::ostringstream formatter;
+    formatter.copyfmt(os);
+
+    auto appendInteger = [&](auto number)
+    {
+        char digits[24];
+        std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), number);
+
+        buffer.append(digits, result.ptr);
+    };
+
+    auto appendFormatted = [&](const auto& value)
+    {
+        formatter.str(std::string());
+        formatter << value;
+
+        buffer += formatter.str();
+    };
+
+    auto appendValue = [&](const T& value)
+    {
+        if constexpr(plainInteger)
+        {
+            if(defaultFlags)
+            {
+                appendInteger(value);
+
+                return;
+            }
+        }
+
+        appendFormatted(value);
+    };
+
+    auto flush = [&]()
+    {
+        os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    };
+
     int index = 0;
-    while ( current ) {
-        os << "Node starting (count " << current->count << ")\n";
-        for ( int local_index = 0; local_index < current->count; ++local_index ) {
-            os << index << " -> " << current->values[local_index] << std::endl;
-            ++index;
+
+    for(LNode* current = head_; current != nullptr; current = current->next)
+    {
+        if(format == DUMP_NODES)
+        {
+            buffer += "Node starting (count ";
+
+            defaultFlags ? appendInteger(current->count) : appendFormatted(current->count);
+
+            buffer += ")\n";
+        }
+
+        for(int localIndex = 0; localIndex < current->count; ++localIndex, ++index)
+        {
+            if(format == DUMP_NODES)
+            {
+                defaultFlags ? appendInteger(index) : appendFormatted(index);
+
+                buffer += " -> ";
+            }
+
+            appendValue(current->data()[localIndex]);
+
+            buffer += '\n';
+
+            if(buffer.size() >= chunkSize)
+            {
+                flush();
+            }
+        }
+
+        if(format == DUMP_NODES)
+        {
+            buffer += "-----------\n";
         }
-        os << "-----------\n";
-        current = current->next;
     }
-    return os;
+
+    flush();
 }
 
 /**
@@ -45,37 +161,87 @@ std::ostream& operator<<( std::ostream &os, Lariat<T, Size> const & list )
  * @tparam Size - size of each node in container
  */
 template<typename T, int Size>
-Lariat<T, Size>::Lariat() : head_(nullptr), tail_(nullptr), size_(0), nodecount_(0), asize_(Size)
+Lariat<T, Size>::Lariat() : head_(nullptr), tail_(nullptr), size_(0), nodecount_(0), asize_(Size > 0 ? Size : default_capacity()), root_(nullptr), freeNodes_(nullptr), freecount_(0), splitPolicy_(SPLIT_BALANCED),
+                         compactCursor_(nullptr), mergeThreshold_(0), finger_(nullptr), fingerBase_(0)
 {
     
 }
 
 /**
- * @brief Copy constructor
+ * @brief Construct a lariat whose nodes hold a capacity chosen at runtime, so it can be
+ *        tuned per list to the value size or the workload, like 4096 / sizeof(T) for page
+ *        sized nodes. Only for a Size of LARIAT_DYNAMIC_SIZE, a fixed Size is faster.
+ * 
+ * @param nodeCapacity - the number of items each node holds
+ */
+template<typename T, int Size>
+Lariat<T, Size>::Lariat(int nodeCapacity) : Lariat()
+{
+    static_assert(Size == LARIAT_DYNAMIC_SIZE, "the node capacity is the Size template argument");
+
+    if(nodeCapacity < 1)
+    {
+        throw LariatException(LariatException::E_BAD_INDEX, "Node capacity must be positive");
+    }
+
+    asize_ = nodeCapacity;
+}
+
+/**
+ * @brief Construct a lariat holding the values of a range in order. The values fill whole
+ *        nodes, and with a known length all the nodes come from the pool in one allocation.
+ * 
+ * @param first - first value of the range
+ * @param last - one past the last value of the range
+ */
+template<typename T, int Size>
+template<typename InputIt, typename>
+Lariat<T, Size>::Lariat(InputIt first, InputIt last) : Lariat()
+{
+    insert(0, first, last);
+}
+
+/**
+ * @brief Construct a lariat holding a list of values in order
+ * 
+ * @param values - values to hold
+ */
+template<typename T, int Size>
+Lariat<T, Size>::Lariat(std::initializer_list<T> values) : Lariat()
+{
+    insert(0, values.begin(), values.end());
+}
+
+/**
+ * @brief Copy constructor, clones the other lariat node by node
  * 
  * @tparam T - the type the container will be
  * @tparam Size - size of each node in container
  * @param rhs - lariat to copy
  */
 template<typename T, int Size>
-Lariat<T, Size>::Lariat(const Lariat& rhs) : head_(nullptr), tail_(nullptr), size_(0), nodecount_(0), asize_(Size)
+Lariat<T, Size>::Lariat(const Lariat& rhs) : head_(nullptr), tail_(nullptr), size_(0), nodecount_(0), asize_(rhs.asize_), root_(nullptr), freeNodes_(nullptr), freecount_(0),
+                                              splitPolicy_(rhs.splitPolicy_), compactCursor_(nullptr), mergeThreshold_(rhs.mergeThreshold_),
+                                              finger_(nullptr), fingerBase_(0)
 {
-    LNode* walker = rhs.head_;
-
-    while(walker != nullptr)
+    try
     {
-        // add all values to copied lariat
-        for(int i = 0; i < walker->count; ++i)
-        {
-            push_back(walker->values[i]);
-        }
+        copy_nodes(rhs);
+    }
+    catch(...)
+    {
+        // the destructor won't run, free what was copied
+        clear();
+        shrink_to_fit();
 
-        walker = walker->next;
+        throw;
     }
 }
 
 /**
- * @brief Copy constructor for lariat of different template specifications
+ * @brief Copy constructor for lariat of different template specifications. The values
+ *        are streamed into completely full nodes. A dynamic size takes the node capacity
+ *        of the other lariat.
  * 
  * @tparam T - the type the container will be
  * @tparam Size - size of each node in container
@@ -85,49 +251,186 @@ Lariat<T, Size>::Lariat(const Lariat& rhs) : head_(nullptr), tail_(nullptr), siz
  */
 template<typename T, int Size>
 template<typename U, int USize>
-Lariat<T, Size>::Lariat(const Lariat<U, USize>& rhs) : head_(nullptr), tail_(nullptr), size_(0), nodecount_(0), asize_(Size)
+Lariat<T, Size>::Lariat(const Lariat<U, USize>& rhs) : head_(nullptr), tail_(nullptr), size_(0), nodecount_(0), asize_(Size > 0 ? Size : rhs.asize_), root_(nullptr), freeNodes_(nullptr), freecount_(0),
+                                                      splitPolicy_(rhs.splitPolicy_), compactCursor_(nullptr), mergeThreshold_(rhs.mergeThreshold_),
+                                                      finger_(nullptr), fingerBase_(0)
 {
     typename Lariat<U, USize>::LNode* walker = rhs.head_;
+    int localIndex = 0;
 
-    while(walker != nullptr)
+    try
     {
-        // add all values to copied lariat
-        for(int i = 0; i < walker->count; ++i)
-        {
-            push_back(static_cast<T>(walker->values[i]));
-        }
+        // every node will be full except the last
+        reserve_nodes(nodes_for(rhs.size_));
 
-        walker = walker->next;
+        insert_values(0, [&]() { return walker == nullptr; },
+                         [&](T* slot) 
+                         {
+                             new (slot) T(static_cast<T>(walker->data()[localIndex]));
+
+                             // step to the next node of the other lariat
+                             if(++localIndex == walker->count)
+                             {
+                                 walker = walker->next;
+                                 localIndex = 0;
+                             }
+                         });
+    }
+    catch(...)
+    {
+        // the destructor won't run, free what was copied
+        clear();
+        shrink_to_fit();
+
+        throw;
     }
 }
 
 /**
- * @brief Assignment operator for lariat
+ * @brief Assignment operator for lariat, clones the other lariat node by node. A dynamic
+ *        size takes the node capacity of the other lariat.
  * 
  * @param other - lariat that will be assigned
  */
 template<typename T, int Size>
 Lariat<T, Size>& Lariat<T, Size>::operator=(const Lariat<T, Size>& other)
 {
-    clear(); // clear all current values
+    if(this == &other)
+    {
+        return *this;
+    }
 
-    LNode* walker = other.head_;
+    clear(); // clear all current values, the nodes go back to the pool to be reused
 
-    while(walker != nullptr)
+    // the pooled nodes are the wrong size for the other capacity
+    if(asize_ != other.asize_)
     {
-        // add all values to new assigned lariat
-        for(int i = 0; i < walker->count; ++i)
-        {
-            push_back(walker->values[i]);
-        }
+        shrink_to_fit();
 
-        walker = walker->next;
+        asize_ = other.asize_;
+    }
+
+    try
+    {
+        copy_nodes(other);
+    }
+    catch(...)
+    {
+        // don't leave a partial copy
+        clear();
+
+        throw;
     }
 
     // return the copied lariat
     return *this;
 }
 
+/**
+ * @brief Move constructor, takes the nodes of the other lariat and leaves it empty
+ * 
+ * @param rhs - lariat to move from
+ */
+template<typename T, int Size>
+Lariat<T, Size>::Lariat(Lariat&& rhs) noexcept : head_(rhs.head_), tail_(rhs.tail_), size_(rhs.size_), nodecount_(rhs.nodecount_), asize_(rhs.asize_),
+                                                  root_(rhs.root_), freeNodes_(rhs.freeNodes_), freecount_(rhs.freecount_), splitPolicy_(rhs.splitPolicy_),
+                                                  compactCursor_(rhs.compactCursor_), mergeThreshold_(rhs.mergeThreshold_),
+                                                  finger_(rhs.finger_), fingerBase_(rhs.fingerBase_)
+{
+    rhs.head_ = nullptr;
+    rhs.tail_ = nullptr;
+    rhs.root_ = nullptr;
+    rhs.freeNodes_ = nullptr;
+    rhs.compactCursor_ = nullptr;
+    rhs.finger_ = nullptr;
+    rhs.size_ = 0;
+    rhs.nodecount_ = 0;
+    rhs.freecount_ = 0;
+}
+
+/**
+ * @brief Move assignment operator, frees the current nodes and takes the nodes of the other lariat
+ * 
+ * @param other - lariat to move from
+ */
+template<typename T, int Size>
+Lariat<T, Size>& Lariat<T, Size>::operator=(Lariat<T, Size>&& other) noexcept
+{
+    if(this == &other)
+    {
+        return *this;
+    }
+
+    // free everything we have now
+    clear();
+    shrink_to_fit();
+
+    // take the other lariat's nodes and pool
+    head_ = other.head_;
+    tail_ = other.tail_;
+    size_ = other.size_;
+    nodecount_ = other.nodecount_;
+    asize_ = other.asize_;
+    root_ = other.root_;
+    freeNodes_ = other.freeNodes_;
+    freecount_ = other.freecount_;
+    splitPolicy_ = other.splitPolicy_;
+    compactCursor_ = other.compactCursor_;
+    mergeThreshold_ = other.mergeThreshold_;
+    finger_ = other.finger_;
+    fingerBase_ = other.fingerBase_;
+
+    // leave the other lariat empty
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.root_ = nullptr;
+    other.freeNodes_ = nullptr;
+    other.compactCursor_ = nullptr;
+    other.finger_ = nullptr;
+    other.size_ = 0;
+    other.nodecount_ = 0;
+    other.freecount_ = 0;
+
+    return *this;
+}
+
+/**
+ * @brief replaces the values with the values of a range, filling whole nodes. The range
+ *        can't refer to values in this list. If a value can't be copied the list is left empty.
+ * 
+ * @param first - first value of the range
+ * @param last - one past the last value of the range
+ */
+template<typename T, int Size>
+template<typename InputIt, typename>
+void Lariat<T, Size>::assign(InputIt first, InputIt last)
+{
+    clear(); // the nodes go back to the pool to be filled again
+
+    try
+    {
+        insert(0, first, last);
+    }
+    catch(...)
+    {
+        // don't leave a partial copy
+        clear();
+
+        throw;
+    }
+}
+
+/**
+ * @brief replaces the values with a list of values
+ * 
+ * @param values - values to hold
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::assign(std::initializer_list<T> values)
+{
+    assign(values.begin(), values.end());
+}
+
 /**
  * @brief Destroy the Lariat< T,  Size>:: Lariat object
  */
@@ -136,6 +439,9 @@ Lariat<T, Size>::~Lariat()
 {
     // clear and delete all nodes and values
     clear();
+
+    // give the pooled nodes back
+    shrink_to_fit();
 }
 
 /**
@@ -148,7 +454,76 @@ Lariat<T, Size>::~Lariat()
 template<typename T, int Size>
 void Lariat<T, Size>::insert(int index, const T& value)
 {
+    emplace(index, value);
+}
+
+/**
+ * @brief Insert an element into the data structure at the index by moving it
+ * 
+ * @param index - index to insert
+ * @param value - value to move in
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::insert(int index, T&& value)
+{
+    emplace(index, std::move(value));
+}
+
+/**
+ * @brief push a value to the back of the container
+ * 
+ * @param value - the value to push
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::push_back(const T& value)
+{
+    emplace_back(value);
+}
+
+/**
+ * @brief push a value to the back of the container by moving it
+ * 
+ * @param value - the value to move in
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::push_back(T&& value)
+{
+    emplace_back(std::move(value));
+}
+
+/**
+ * @brief push a value to the front of the container
+ * 
+ * @param value - value to push
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::push_front(const T& value)
+{
+    emplace_front(value);
+}
+
+/**
+ * @brief push a value to the front of the container by moving it
+ * 
+ * @param value - value to move in
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::push_front(T&& value)
+{
+    emplace_front(std::move(value));
+}
 
+/**
+ * @brief Construct an element at the index, between the element at [index - 1] 
+ *        and the element at [index]
+ * 
+ * @param index - index to insert
+ * @param args - arguments to construct the value with
+ */
+template<typename T, int Size>
+template<typename... Args>
+void Lariat<T, Size>::emplace(int index, Args&&... args)
+{
     // if the index is invalid, throw exception
     if(index < 0 || index > size_)
     {
@@ -158,49 +533,68 @@ void Lariat<T, Size>::insert(int index, const T& value)
     // if the index is last, simply push back
     if(index == size_)
     {
-        push_back(value);
+        emplace_back(std::forward<Args>(args)...);
 
         return;
     }
     else if(index == 0) // if the index is first, simply push front
     {
-        push_front(value);
+        emplace_front(std::forward<Args>(args)...);
 
         return;
     }
 
+    // build the value before anything moves, the arguments could refer to values in the list
+    T value(std::forward<Args>(args)...);
+
     ElementInfo insertInfo = find_element(index);
 
     // If insert node has room
     if(insertInfo.node->count < asize_)
     {
-        // Put value at the end of the node
-        insertInfo.node->values[insertInfo.node->count] = value;
-        insertInfo.node->count++;
-        size_++;
-
-        // Put the added value at the correct index and shift all subsequent values up
-        shiftUp(insertInfo.node, insertInfo.localIndex);
+        // Shift the values at and after the index up and put the value in the gap
+        insert_in_node(insertInfo.node, insertInfo.localIndex, std::move(value));
     }
     else
     {
         // if the node doesn't have room, split it and insert
-        insert_in_full_node(insertInfo.node, insertInfo.localIndex, value);
+        insert_in_full_node(insertInfo.node, insertInfo.localIndex, std::move(value));
     }
 }
 
 /**
- * @brief push a value to the back of the container
+ * @brief Construct a value at the back of the container. If the tail has room the value
+ *        is constructed directly in it.
  * 
- * @param value - the value to push
+ * @param args - arguments to construct the value with
  */
 template<typename T, int Size>
-void Lariat<T, Size>::push_back(const T& value)
+template<typename... Args>
+void Lariat<T, Size>::emplace_back(Args&&... args)
 {
     // If it's the first value being inserted
     if(head_ == nullptr && tail_ == nullptr)
     {
-        push_first_value(value);
+        push_first_value(std::forward<Args>(args)...);
+
+        return;
+    }
+
+    // If the tail is full and appends get their own node, start a new tail without moving anything
+    if(tail_->count == asize_ && splitPolicy_ == SPLIT_APPEND)
+    {
+        LNode* node = append_node();
+
+        try
+        {
+            push_back_in_node(node, std::forward<Args>(args)...);
+        }
+        catch(...)
+        {
+            deleteNode(node);
+
+            throw;
+        }
 
         return;
     }
@@ -208,602 +602,3653 @@ void Lariat<T, Size>::push_back(const T& value)
     // If the tail is full
     if(tail_->count == asize_)
     {
+        // build the value before the split moves the values it could refer to
+        T value(std::forward<Args>(args)...);
+
         split(tail_);
+
+        push_back_in_node(tail_, std::move(value));
+
+        return;
     }
 
     // Put the value in the available node
-    push_back_in_node(tail_, value);
+    push_back_in_node(tail_, std::forward<Args>(args)...);
 }
 
 /**
- * @brief push a value to the front of the container
+ * @brief Construct a value at the front of the container
  * 
- * @param value - value to push
+ * @param args - arguments to construct the value with
  */
 template<typename T, int Size>
-void Lariat<T, Size>::push_front(const T& value)
+template<typename... Args>
+void Lariat<T, Size>::emplace_front(Args&&... args)
 {
     if(head_ == nullptr)
     {
         // If head is empty, just push value
-        push_first_value(value);
+        push_first_value(std::forward<Args>(args)...);
 
         return;
     }
-    else if(head_->count == asize_)
+
+    // If the head is full and prepends get their own node, start a new head without moving anything
+    if(head_->count == asize_ && splitPolicy_ == SPLIT_PREPEND)
     {
-        // Put the last value in list at the front and shift all subsequent values up
-        shiftUp(head_, 0);
+        LNode* node = prepend_node();
+
+        // the value goes in the last slot, so the pushes after it have room at the front
+        node->begin = asize_ - 1;
+
+        try
+        {
+            push_back_in_node(node, std::forward<Args>(args)...);
+        }
+        catch(...)
+        {
+            deleteNode(node);
+
+            throw;
+        }
 
-        // Get the overflow value
-        T overflow = head_->values[0];
-        
-        // Set the value at front to correct value
-        head_->values[0] = value;
+        return;
+    }
 
-        // Perform the split
-        LNode* splitNode = split(head_);
+    // build the value before anything moves, the arguments could refer to values in the list
+    T value(std::forward<Args>(args)...);
 
-        // Push the overflow value back into the split node
-        push_back_in_node(splitNode, overflow);
+    if(head_->count == asize_)
+    {
+        // split the head and put the value at its front
+        insert_in_full_node(head_, 0, std::move(value));
     }
     else
     {
-        // If the head has room, put the value at the end
-        head_->values[head_->count] = value;
-        head_->count++;
-        size_++;
+        // move the values to the back once so the pushes after this move nothing, a lone node keeps room at both ends
+        if(head_->begin == 0)
+        {
+            rebase(head_, head_ == tail_ ? (asize_ - head_->count + 1) / 2 : asize_ - head_->count);
+        }
 
-        // Put the added value at the front and shift all subsequent values up
-        shiftUp(head_, 0);
+        insert_in_node(head_, 0, std::move(value));
     }
 }
 
 /**
- * @brief Erase a value at an index
+ * @brief returns an appender that streams values onto the back of the list. The list
+ *        can't be used until the appender flushed.
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::Appender Lariat<T, Size>::appender()
+{
+    return Appender(*this);
+}
+
+/**
+ * @brief Insert the values of a range at the index, in order. The start node is found
+ *        once, the values fill its free slots and then new full nodes after it. When the
+ *        length of the range is known the nodes are reserved first, in one allocation.
+ *        The range can't refer to values in this list.
  * 
- * @param index - index to erase
+ * @param index - index to insert the first value at
+ * @param first - first value of the range
+ * @param last - one past the last value of the range
  */
 template<typename T, int Size>
-void Lariat<T, Size>::erase(int index)
+template<typename InputIt, typename>
+void Lariat<T, Size>::insert(int index, InputIt first, InputIt last)
 {
-    if(index == 0)
+    if constexpr(std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::forward_iterator_tag>::value)
     {
-        pop_front();
-
-        return;
+        reserve_for_insert(index, std::distance(first, last));
     }
-    else if(index == size_)
-    {
+
+    insert_values(index, [&]() { return first == last; },
+                         [&](T* slot) { new (slot) T(*first); ++first; });
+}
+
+/**
+ * @brief Insert count copies of a value at the index
+ * 
+ * @param index - index to insert the first copy at
+ * @param count - number of copies
+ * @param value - value to copy
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::insert(int index, int count, const T& value)
+{
+    // copy the value first, it could be in the part of the list that moves
+    T copy(value);
+
+    reserve_for_insert(index, count);
+
+    insert_values(index, [&]() { return count <= 0; },
+                         [&](T* slot) { new (slot) T(copy); --count; });
+}
+
+/**
+ * @brief moves every value of another list into this one before an index by relinking its
+ *        nodes, so no value is copied. Only the node holding the index is split, the indexes
+ *        of the lists are joined in O(log nodes). Lists with different node capacities move
+ *        their values instead.
+ * 
+ * @param index - index the values of other are inserted before, size to append them
+ * @param other - list to take the values from, left empty
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::splice(int index, Lariat&& other)
+{
+    if(index < 0 || index > size_)
+    {
+        throw LariatException(LariatException::E_BAD_INDEX, "Subscript is out of range");
+    }
+
+    if(index == size_)
+    {
+        append(std::move(other));
+
+        return;
+    }
+
+    if(this == &other || other.head_ == nullptr)
+    {
+        return;
+    }
+
+    // the nodes of another capacity don't fit this list
+    if(other.asize_ != asize_)
+    {
+        insert(index, std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+
+        other.clear();
+
+        return;
+    }
+
+    LNode* boundary = node_boundary(index);
+    LNode* before = boundary->prev;
+
+    // put the index of the other list between the two halves of this one
+    LNode* first;
+    LNode* second;
+
+    index_split(root_, index, first, second);
+
+    root_ = index_join(index_join(first, other.root_), second);
+
+    // link the other chain in front of the boundary node
+    if(before == nullptr)
+    {
+        head_ = other.head_;
+    }
+    else
+    {
+        before->next = other.head_;
+    }
+
+    other.head_->prev = before;
+    other.tail_->next = boundary;
+    boundary->prev = other.tail_;
+
+    size_ += other.size_;
+    nodecount_ += other.nodecount_;
+
+    // the values after the index moved, a compaction pass starts over
+    finger_ = nullptr;
+    compactCursor_ = nullptr;
+
+    other.forget_nodes();
+}
+
+/**
+ * @brief moves every value of another list to the end of this one by linking its nodes
+ *        after the tail. Lists with different node capacities move their values instead.
+ * 
+ * @param other - list to take the values from, left empty
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::append(Lariat&& other)
+{
+    if(this == &other || other.head_ == nullptr)
+    {
+        return;
+    }
+
+    // the nodes of another capacity don't fit this list
+    if(other.asize_ != asize_)
+    {
+        insert(size_, std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+
+        other.clear();
+
+        return;
+    }
+
+    if(head_ == nullptr)
+    {
+        head_ = other.head_;
+    }
+    else
+    {
+        tail_->next = other.head_;
+        other.head_->prev = tail_;
+    }
+
+    tail_ = other.tail_;
+    root_ = index_join(root_, other.root_);
+
+    // nothing before the old tail moved, so the finger still holds
+    size_ += other.size_;
+    nodecount_ += other.nodecount_;
+
+    other.forget_nodes();
+}
+
+/**
+ * @brief cuts the list at an index. The values from the index on are moved to a new list
+ *        by unlinking their nodes, only the node holding the index is split. The new list
+ *        has the same node capacity, split policy and merge threshold.
+ * 
+ * @param index - index of the first value of the new list, size for an empty one
+ * @return - a list of the values from the index on
+ */
+template<typename T, int Size>
+Lariat<T, Size> Lariat<T, Size>::split_at(int index)
+{
+    if(index < 0 || index > size_)
+    {
+        throw LariatException(LariatException::E_BAD_INDEX, "Subscript is out of range");
+    }
+
+    Lariat result;
+
+    result.asize_ = asize_;
+    result.splitPolicy_ = splitPolicy_;
+    result.mergeThreshold_ = mergeThreshold_;
+
+    if(index == size_)
+    {
+        return result;
+    }
+
+    LNode* boundary = node_boundary(index);
+    LNode* last = boundary->prev;
+
+    LNode* first;
+    LNode* second;
+
+    index_split(root_, index, first, second);
+
+    // the new list takes the nodes from the boundary on
+    result.head_ = boundary;
+    result.tail_ = tail_;
+    result.root_ = second;
+    result.size_ = size_ - index;
+    result.nodecount_ = second->subtreeNodes;
+
+    boundary->prev = nullptr;
+
+    if(last == nullptr)
+    {
+        head_ = nullptr;
+    }
+    else
+    {
+        last->next = nullptr;
+    }
+
+    tail_ = last;
+    root_ = first;
+    size_ = index;
+    nodecount_ -= result.nodecount_;
+
+    // the finger and the cursor could be in the other list now
+    finger_ = nullptr;
+    compactCursor_ = nullptr;
+
+    return result;
+}
+
+/**
+ * @brief Erase a value at an index
+ * 
+ * @param index - index to erase
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::erase(int index)
+{
+    // if the index is invalid, throw exception
+    if(index < 0 || index >= size_)
+    {
+        throw LariatException(LariatException::E_BAD_INDEX, "Subscript is out of range");
+    }
+
+    if(index == 0)
+    {
+        pop_front();
+
+        return;
+    }
+    else if(index == size_ - 1)
+    {
         pop_back();
 
-        return;
+        return;
+    }
+
+    Lariat<T, Size>::ElementInfo elementInfo = find_element(index);
+
+    // Destroy the element and cover it with the values on its shorter side
+    elementInfo.node->data()[elementInfo.localIndex].~T();
+    close_gap(elementInfo.node, elementInfo.localIndex);
+
+    // update count and size values
+    elementInfo.node->count--;
+    size_--;
+
+    // delete the node if it's empty
+    if(elementInfo.node->count == 0)
+    {
+        deleteNode(elementInfo.node);
+    }
+    else
+    {
+        index_update(elementInfo.node);
+        merge_after_erase(elementInfo.node);
+    }
+}
+
+/**
+ * @brief Erase the values from first_index up to but not including last_index. Only the
+ *        two nodes at the ends of the range are shifted, the nodes between are deleted whole.
+ * 
+ * @param first_index - index of the first value to erase
+ * @param last_index - index one past the last value to erase
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::erase(int first_index, int last_index)
+{
+    // if the range is invalid, throw exception
+    if(first_index < 0 || last_index > size_ || first_index > last_index)
+    {
+        throw LariatException(LariatException::E_BAD_INDEX, "Subscript is out of range");
+    }
+
+    if(first_index == last_index)
+    {
+        return;
+    }
+
+    ElementInfo firstInfo = find_element(first_index);
+    ElementInfo lastInfo = find_element(last_index - 1);
+
+    LNode* firstNode = firstInfo.node;
+    LNode* lastNode = lastInfo.node;
+
+    size_ -= last_index - first_index;
+
+    if(firstNode == lastNode)
+    {
+        // the whole range is in one node, destroy it and cover it with the values on its shorter side
+        int erased = lastInfo.localIndex - firstInfo.localIndex + 1;
+        int after = firstNode->count - lastInfo.localIndex - 1;
+
+        for(int i = firstInfo.localIndex; i <= lastInfo.localIndex; ++i)
+        {
+            firstNode->data()[i].~T();
+        }
+
+        if(firstInfo.localIndex < after)
+        {
+            relocate_values(firstNode->data() + erased, firstNode->data(), firstInfo.localIndex);
+            firstNode->begin += erased;
+        }
+        else
+        {
+            relocate_values(firstNode->data() + firstInfo.localIndex, firstNode->data() + lastInfo.localIndex + 1, after);
+        }
+
+        firstNode->count -= erased;
+
+        if(firstNode->count == 0)
+        {
+            deleteNode(firstNode);
+        }
+        else
+        {
+            index_update(firstNode);
+            merge_after_erase(firstNode);
+        }
+
+        return;
+    }
+
+    // destroy the end of the first node
+    for(int i = firstInfo.localIndex; i < firstNode->count; ++i)
+    {
+        firstNode->data()[i].~T();
+    }
+
+    firstNode->count = firstInfo.localIndex;
+
+    // delete every node between the two ends
+    LNode* walker = firstNode->next;
+
+    while(walker != lastNode)
+    {
+        LNode* next = walker->next;
+
+        deleteNode(walker);
+
+        walker = next;
+    }
+
+    // destroy the start of the last node, the rest of it stays put
+    for(int i = 0; i <= lastInfo.localIndex; ++i)
+    {
+        lastNode->data()[i].~T();
+    }
+
+    lastNode->begin += lastInfo.localIndex + 1;
+    lastNode->count -= lastInfo.localIndex + 1;
+
+    // put the two ends together if they fit in one node
+    if(firstNode->count + lastNode->count <= asize_)
+    {
+        if(firstNode->begin + firstNode->count + lastNode->count > asize_)
+        {
+            rebase(firstNode, 0);
+        }
+
+        relocate_values(firstNode->data() + firstNode->count, lastNode->data(), lastNode->count);
+
+        firstNode->count += lastNode->count;
+        lastNode->count = 0;
+    }
+
+    if(lastNode->count == 0)
+    {
+        deleteNode(lastNode);
+        lastNode = nullptr;
+    }
+    else
+    {
+        index_update(lastNode);
+    }
+
+    if(firstNode->count == 0)
+    {
+        deleteNode(firstNode);
+        firstNode = nullptr;
+    }
+    else
+    {
+        index_update(firstNode);
+    }
+
+    // the two ends didn't fit together, so merging the last end can't delete the first one
+    if(lastNode != nullptr)
+    {
+        merge_after_erase(lastNode);
+    }
+
+    if(firstNode != nullptr)
+    {
+        merge_after_erase(firstNode);
+    }
+}
+
+/**
+ * @brief Erase every value the predicate is true for. One pass walks the values with a read
+ *        cursor and packs the kept ones behind it with a write cursor, like compact(), so
+ *        the nodes end up full and the empty ones at the end are deleted. O(n) for any
+ *        number of erased values. If the predicate throws, the values it wasn't called on
+ *        are kept after the packed ones.
+ * 
+ * @param pred - returns true for the values to erase
+ * @return - the number of values erased
+ */
+template<typename T, int Size>
+template<typename Predicate>
+size_t Lariat<T, Size>::erase_if(Predicate pred)
+{
+    size_t erased = 0;
+
+    if(head_ == nullptr)
+    {
+        return erased;
+    }
+
+    LNode* writeNode = head_; // node the kept values are packed into, from its first slot
+    int written = 0;          // values packed into the write node
+    LNode* readNode = head_;  // node being filtered
+    int read = 0;             // values of the read node the predicate was called on
+
+    // sets the counts the pass changed, keeping the values of the read node from the read cursor on
+    auto finish = [&]()
+    {
+        if(readNode == writeNode)
+        {
+            relocate_values(writeNode->values + written, readNode->data() + read, readNode->count - read);
+            written += readNode->count - read;
+        }
+        else if(readNode != nullptr)
+        {
+            readNode->begin += read;
+            readNode->count -= read;
+        }
+
+        writeNode->count = written;
+        writeNode->begin = 0;
+
+        // every count between the cursors changed
+        index_recount(root_);
+
+        compactCursor_ = nullptr;
+    };
+
+    try
+    {
+        for(; readNode != nullptr; readNode = readNode->next)
+        {
+            T* values = readNode->data();
+
+            for(read = 0; read < readNode->count; ++read)
+            {
+                if(pred(values[read]))
+                {
+                    values[read].~T();
+                    size_--;
+                    erased++;
+
+                    continue;
+                }
+
+                // step the write cursor to the next node when this one is full, it is behind the read cursor
+                if(written == asize_)
+                {
+                    writeNode->count = asize_;
+                    writeNode->begin = 0;
+
+                    writeNode = writeNode->next;
+                    written = 0;
+                }
+
+                // the write cursor is never after the read cursor, so the slot is free
+                T* destination = writeNode->values + written;
+
+                if(destination != values + read)
+                {
+                    relocate_values(destination, values + read, 1);
+                    LARIAT_COUNT(compactMoves, 1);
+                }
+
+                written++;
+            }
+
+            // every value of the read node was erased or moved, unless it is the write node
+            if(readNode != writeNode)
+            {
+                readNode->count = 0;
+                readNode->begin = 0;
+            }
+            else
+            {
+                // the read node is done, its values are in the first written slots
+                read = readNode->count;
+            }
+        }
+    }
+    catch(...)
+    {
+        finish();
+
+        // the nodes the pass emptied are between the cursors
+        for(LNode* walker = head_; walker != nullptr; )
+        {
+            LNode* next = walker->next;
+
+            if(walker->count == 0)
+            {
+                deleteNode(walker);
+            }
+
+            walker = next;
+        }
+
+        throw;
+    }
+
+    finish();
+
+    // the write cursor only moves on to write, so it is still at the head if nothing was kept
+    if(size_ == 0)
+    {
+        clear();
+    }
+    else
+    {
+        delete_empty_tail(writeNode);
+    }
+
+    return erased;
+}
+
+/**
+ * @brief delete the last value in the container
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::pop_back()
+{
+    if(tail_ == nullptr)
+        return;
+
+    // destroy the value and update count and size values
+    tail_->data()[tail_->count - 1].~T();
+    tail_->count--;
+    size_--;
+
+    // delete the tail if it's empty
+    if(tail_->count == 0)
+    {
+        deleteNode(tail_);
+    }
+    else
+    {
+        index_update(tail_);
+        merge_after_erase(tail_);
+    }
+}
+
+/**
+ * @brief delete the first value in the container
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::pop_front()
+{
+    if(head_ == nullptr)
+        return;
+
+    // Destroy the first value, the node starts one slot later
+    head_->data()[0].~T();
+    close_gap(head_, 0);
+
+    // update count and size values
+    head_->count--;
+    size_--;
+
+    // delete the head if it's empty
+    if(head_->count == 0)
+    {
+        deleteNode(head_);
+    }
+    else
+    {
+        index_update(head_);
+        merge_after_erase(head_);
+    }
+}
+
+/**
+ * @brief Index operator
+ * @param index - index to get
+ */
+template<typename T, int Size>
+T& Lariat<T, Size>::operator[](int index)
+{
+    Lariat<T, Size>::ElementInfo elementInfo = find_element(index);
+
+    return elementInfo.node->data()[elementInfo.localIndex];
+}
+
+/**
+ * @brief Index operator
+ * @param index - index to get
+ */
+template<typename T, int Size>
+const T& Lariat<T, Size>::operator[](int index) const
+{
+    // a const list can't move the finger, so the node is found through the index
+    Lariat<T, Size>::ElementInfo elementInfo = index_find(index);
+
+    return elementInfo.node->data()[elementInfo.localIndex];
+}
+
+/**
+ * @brief returns the first value of the container
+ */
+template<typename T, int Size>
+T& Lariat<T, Size>::first()
+{
+    return head_->data()[0];
+}
+
+/**
+ * @brief returns the first value of the container
+ */
+template<typename T, int Size>
+const T& Lariat<T, Size>::first() const
+{
+    return head_->data()[0];
+}
+
+/**
+ * @brief returns the last value of the container
+ */
+template<typename T, int Size>
+T& Lariat<T, Size>::last()
+{
+    return tail_->data()[tail_->count - 1];
+}
+
+/**
+ * @brief returns the last value of the container
+ */
+template<typename T, int Size>
+const T& Lariat<T, Size>::last() const
+{
+    return tail_->data()[tail_->count - 1];
+}
+
+/**
+ * @brief Walks through the list and finds the index of matching value. Arithmetic values
+ *        in large nodes are compared with vector instructions a node at a time.
+ * 
+ * @param value - value to find
+ * @return index of the value. if it can't find found, returns the size of the list.
+ */
+template<typename T, int Size>
+unsigned Lariat<T, Size>::find(const T& value) const
+{
+    LNode* walker = head_;
+
+    int index = 0;
+
+    while(walker != nullptr)
+    {
+        int localIndex = find_in_values(walker->data(), walker->count, value);
+
+        // if the value matches, return
+        if(localIndex < walker->count)
+        {
+            return index + localIndex;
+        }
+
+        index += walker->count;
+
+        walker = walker->next;
+    }
+
+    // otherwise return the size of the list
+    return size_;
+}
+
+/**
+ * @brief returns the index of the first value that isn't before a value in a sorted list,
+ *        where the value would be inserted before any equal values. Picks the node by
+ *        descending the index, then binary searches inside it.
+ * 
+ * @param value - value to look for
+ * @param comp - the order of the list, true when its first argument is before its second
+ * @return - index of the first value not before value, size (one past last) if there is none
+ */
+template<typename T, int Size>
+template<typename Compare>
+unsigned Lariat<T, Size>::lower_bound(const T& value, Compare comp) const
+{
+    return partition_index([&](const T& element) { return comp(element, value); });
+}
+
+/**
+ * @brief returns the index of the first value after a value in a sorted list, where the
+ *        value would be inserted after any equal values
+ * 
+ * @param value - value to look for
+ * @param comp - the order of the list, true when its first argument is before its second
+ * @return - index of the first value after value, size (one past last) if there is none
+ */
+template<typename T, int Size>
+template<typename Compare>
+unsigned Lariat<T, Size>::upper_bound(const T& value, Compare comp) const
+{
+    return partition_index([&](const T& element) { return !comp(value, element); });
+}
+
+/**
+ * @brief inserts a value into a sorted list where it keeps the list sorted, after any
+ *        values equal to it
+ * 
+ * @param value - value to insert
+ * @param comp - the order of the list, true when its first argument is before its second
+ * @return - the index the value was inserted at
+ */
+template<typename T, int Size>
+template<typename Compare>
+unsigned Lariat<T, Size>::insert_sorted(const T& value, Compare comp)
+{
+    unsigned index = upper_bound(value, comp);
+
+    emplace(index, value);
+
+    return index;
+}
+
+/**
+ * @brief moves a value into a sorted list where it keeps the list sorted, after any
+ *        values equal to it
+ * 
+ * @param value - value to insert
+ * @param comp - the order of the list, true when its first argument is before its second
+ * @return - the index the value was inserted at
+ */
+template<typename T, int Size>
+template<typename Compare>
+unsigned Lariat<T, Size>::insert_sorted(T&& value, Compare comp)
+{
+    unsigned index = upper_bound(value, comp);
+
+    emplace(index, std::move(value));
+
+    return index;
+}
+
+/**
+ * @brief returns an iterator to the first value of the container
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::iterator Lariat<T, Size>::begin()
+{
+    return iterator(head_, 0);
+}
+
+/**
+ * @brief returns an iterator one past the last value of the container
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::iterator Lariat<T, Size>::end()
+{
+    // the end is one past the last value in the tail
+    return tail_ != nullptr ? iterator(tail_, tail_->count) : iterator(nullptr, 0);
+}
+
+/**
+ * @brief returns an iterator to the first value of the container
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::const_iterator Lariat<T, Size>::begin() const
+{
+    return const_iterator(head_, 0);
+}
+
+/**
+ * @brief returns an iterator one past the last value of the container
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::const_iterator Lariat<T, Size>::end() const
+{
+    return tail_ != nullptr ? const_iterator(tail_, tail_->count) : const_iterator(nullptr, 0);
+}
+
+/**
+ * @brief returns an iterator to the first value of the container
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::const_iterator Lariat<T, Size>::cbegin() const
+{
+    return begin();
+}
+
+/**
+ * @brief returns an iterator one past the last value of the container
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::const_iterator Lariat<T, Size>::cend() const
+{
+    return end();
+}
+
+/**
+ * @brief returns a reverse iterator to the last value of the container
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::reverse_iterator Lariat<T, Size>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+/**
+ * @brief returns a reverse iterator one before the first value of the container
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::reverse_iterator Lariat<T, Size>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+/**
+ * @brief returns a reverse iterator to the last value of the container
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::const_reverse_iterator Lariat<T, Size>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+/**
+ * @brief returns a reverse iterator one before the first value of the container
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::const_reverse_iterator Lariat<T, Size>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+/**
+ * @brief returns the size of the list
+ */
+template<typename T, int Size>
+size_t Lariat<T, Size>::size(void) const
+{
+    return size_;
+}
+
+/**
+ * @brief returns the number of items a node holds, Size or the capacity given to the
+ *        constructor
+ */
+template<typename T, int Size>
+int Lariat<T, Size>::node_capacity() const
+{
+    return asize_;
+}
+
+/**
+ * @brief returns the fraction of the node slots that hold items, 1 when every node is full
+ */
+template<typename T, int Size>
+double Lariat<T, Size>::utilization() const
+{
+    if(nodecount_ == 0)
+    {
+        return 0.0;
+    }
+
+    return static_cast<double>(size_) / (static_cast<double>(nodecount_) * asize_);
+}
+
+/**
+ * @brief reports how the list is laid out: the number of nodes, how full they are and
+ *        the memory they take. Walks every node. With LARIAT_STATS defined it also reports
+ *        the counts of splits, node allocations, lookups, shifts and compaction moves.
+ * 
+ * @return the statistics of the list
+ */
+template<typename T, int Size>
+LariatStats Lariat<T, Size>::stats() const
+{
+    LariatStats stats = {};
+
+    stats.size = size_;
+    stats.nodeCount = nodecount_;
+    stats.nodeCapacity = asize_;
+    stats.pooledNodes = freecount_;
+    stats.loadFactor = utilization();
+    stats.bytesUsed = sizeof(*this) + node_bytes() * (static_cast<size_t>(nodecount_) + freecount_);
+
+    for(LNode* walker = head_; walker != nullptr; walker = walker->next)
+    {
+        int bucket = walker->count * LariatStats::FILL_BUCKETS / asize_;
+
+        // full nodes go in the last bucket
+        if(bucket == LariatStats::FILL_BUCKETS)
+        {
+            bucket--;
+        }
+
+        stats.fillHistogram[bucket]++;
+    }
+
+#ifdef LARIAT_STATS
+    stats.splits = counters_.splits.load(std::memory_order_relaxed);
+    stats.nodeAllocations = counters_.nodeAllocations.load(std::memory_order_relaxed);
+    stats.nodeFrees = counters_.nodeFrees.load(std::memory_order_relaxed);
+    stats.findHops = counters_.findHops.load(std::memory_order_relaxed);
+    stats.shiftMoves = counters_.shiftMoves.load(std::memory_order_relaxed);
+    stats.compactMoves = counters_.compactMoves.load(std::memory_order_relaxed);
+#endif
+
+    return stats;
+}
+
+/**
+ * @brief sets how full nodes split when pushing on the ends. Balanced splits the node in half,
+ *        append and prepend start a new empty node at that end so streams leave full nodes behind.
+ * 
+ * @param policy - the split policy
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::set_split_policy(LariatSplitPolicy policy)
+{
+    splitPolicy_ = policy;
+}
+
+/**
+ * @brief returns how full nodes split when pushing on the ends
+ */
+template<typename T, int Size>
+LariatSplitPolicy Lariat<T, Size>::split_policy() const
+{
+    return splitPolicy_;
+}
+
+/**
+ * @brief deletes and clears every node in the list
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::clear(void)
+{
+    LNode* walker = head_;
+
+    // walk through the list
+    while(walker != nullptr)
+    {
+        // destroy the values and return all nodes to the pool
+        LNode* next = walker->next;
+
+        free_node(walker);
+        LARIAT_COUNT(nodeFrees, 1);
+
+        walker = next;
+    }
+
+    // reset values
+    size_ = 0;
+    nodecount_ = 0;
+
+    head_ = nullptr;
+    tail_ = nullptr;
+    root_ = nullptr;
+    compactCursor_ = nullptr;
+    finger_ = nullptr;
+}
+
+/**
+ * @brief Compact takes all the data stored in the linked list and moves it into the
+          smallest number of nodes possible. Then it frees all empty nodes at the
+          end of the list.
+ * 
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::compact()
+{
+    if(head_ == nullptr)
+    {
+        return;
+    }
+
+    LNode* leftFoot = head_;
+
+    // walk the left foot to the first node that is not already full, or the tail
+    while(leftFoot->count == asize_ && leftFoot->next != nullptr)
+    {
+        leftFoot = leftFoot->next;
+    }
+
+    // the right foot starts on the left foot, so the values of that node move to its first slot too
+    LNode* rightFoot = leftFoot;
+
+    // walk through the list while the right foot hasn't lost the list.
+    while(rightFoot != nullptr)
+    {
+        int rightFootCount = rightFoot->count;
+        T* rightFootData = rightFoot->data();
+        int moved = 0;
+
+        // the nodes are filled from their first slot, the left foot never passes the right foot so
+        // every node it reaches was emptied here first
+        rightFoot->count = 0;
+        rightFoot->begin = 0;
+
+        // step the left foot to the next node if it is full
+        if(leftFoot->count == asize_)
+        {
+            leftFoot = leftFoot->next;
+        }
+
+        while(moved < rightFootCount)
+        {
+            // move as many values from the right foot as fit in the left foot in one block
+            int block = asize_ - leftFoot->count;
+
+            if(block > rightFootCount - moved)
+            {
+                block = rightFootCount - moved;
+            }
+
+            // the left foot can catch up to the right foot, then values that don't move stay put
+            T* destination = leftFoot->values + leftFoot->count;
+            T* source = rightFootData + moved;
+
+            if(destination != source)
+            {
+                relocate_values(destination, source, block);
+                LARIAT_COUNT(compactMoves, block);
+            }
+
+            leftFoot->count += block;
+            moved += block;
+
+            // step the left foot to the next node if it is full
+            if(leftFoot->count == asize_)
+            {
+                leftFoot = leftFoot->next;
+            }
+        }
+
+        rightFoot = rightFoot->next;
+    }
+
+    // every node count may have changed, so recount the whole index
+    index_recount(root_);
+
+    // remove all the extra nodes from the end of the list
+    while(tail_->count == 0)
+    {
+        deleteNode(tail_);
+    }
+
+    // the whole list is compact, a step would start over
+    compactCursor_ = nullptr;
+}
+
+/**
+ * @brief does a bounded part of compact(). Each step fills the node at the cursor from the
+ *        node after it, deleting that node once it is empty, and moves the cursor on when the
+ *        node is full. The cursor is kept between calls, so a list can be compacted a little
+ *        at a time. After a pass every node but the tail is full, like after compact().
+ * 
+ * @param budget - the number of steps to do, each moves at most one node of values
+ * @return true - a pass reached the end of the list, the next call starts at the head again
+ * @return false - there is more to compact
+ */
+template<typename T, int Size>
+bool Lariat<T, Size>::compact_step(int budget)
+{
+    if(head_ == nullptr)
+    {
+        compactCursor_ = nullptr;
+
+        return true;
+    }
+
+    if(compactCursor_ == nullptr)
+    {
+        compactCursor_ = head_;
+    }
+
+    while(budget-- > 0)
+    {
+        LNode* node = compactCursor_;
+        LNode* next = node->next;
+
+        // reached the tail, the pass is done
+        if(next == nullptr)
+        {
+            compactCursor_ = nullptr;
+
+            return true;
+        }
+
+        // nothing to fill, move on
+        if(node->count == asize_)
+        {
+            compactCursor_ = next;
+
+            continue;
+        }
+
+        // the whole next node fits, take it
+        if(merge_with_next(node))
+        {
+            continue;
+        }
+
+        // fill the node from the front of the next one, the rest of that one stays put
+        int block = asize_ - node->count;
+
+        rebase(node, 0);
+
+        relocate_values(node->data() + node->count, next->data(), block);
+        LARIAT_COUNT(compactMoves, block);
+
+        node->count += block;
+        next->count -= block;
+        next->begin += block;
+
+        index_update(node);
+        index_update(next);
+
+        compactCursor_ = next;
+    }
+
+    return false;
+}
+
+/**
+ * @brief sets the fill threshold for merging on erase. When an erase or pop leaves a node with
+ *        fewer than count items, it merges with a neighbor if the two fit in one node, so erasing
+ *        can't leave the list full of nearly empty nodes. 0 turns merging off.
+ * 
+ * @param count - the fill threshold, 0 to turn merging off
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::set_merge_threshold(int count)
+{
+    mergeThreshold_ = count;
+}
+
+/**
+ * @brief returns the fill threshold for merging on erase, 0 when merging is off
+ */
+template<typename T, int Size>
+int Lariat<T, Size>::merge_threshold() const
+{
+    return mergeThreshold_;
+}
+
+/**
+ * @brief makes sure count nodes can be in the list without allocating any more memory.
+ * 
+ * @param count - number of nodes to reserve
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::reserve_nodes(int count)
+{
+    int missing = count - nodecount_ - freecount_;
+
+    // carve all the missing nodes from one slab
+    if(missing > 0)
+    {
+        allocate_slab(missing);
+    }
+}
+
+/**
+ * @brief makes sure the list can hold count items in completely full nodes without
+ *        allocating, counting the nodes already in the list
+ * 
+ * @param count - number of items
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::reserve(int count)
+{
+    reserve_nodes(nodes_for(count));
+}
+
+/**
+ * @brief reserves the nodes an insert of count values at an index can take: full nodes
+ *        for the values, and one for the values after the index that get moved aside.
+ * 
+ * @param index - index the values are inserted at
+ * @param count - number of values
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::reserve_for_insert(int index, std::ptrdiff_t count)
+{
+    if(count <= 0 || index < 0 || index > size_)
+    {
+        return;
+    }
+
+    std::ptrdiff_t nodes = nodecount_ + nodes_for(count) + (index < size_ ? 1 : 0);
+
+    reserve_nodes(static_cast<int>(std::min<std::ptrdiff_t>(nodes, INT32_MAX)));
+}
+
+/**
+ * @brief returns the number of nodes count items fill, the last one partly. Counted in
+ *        64 bits so a count near INT32_MAX doesn't overflow
+ * 
+ * @param count - number of items
+ */
+template<typename T, int Size>
+int Lariat<T, Size>::nodes_for(std::ptrdiff_t count) const
+{
+    if(count <= 0)
+    {
+        return 0;
+    }
+
+    return static_cast<int>((static_cast<int64_t>(count) + asize_ - 1) / asize_);
+}
+
+/**
+ * @brief frees every pooled node that isn't in the list. A slab's memory is freed once
+ *        every node carved from it has been freed.
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::shrink_to_fit()
+{
+    while(freeNodes_ != nullptr)
+    {
+        LNode* next = freeNodes_->next;
+
+        release_node(freeNodes_);
+
+        freeNodes_ = next;
+    }
+
+    freecount_ = 0;
+}
+
+/**
+ * @brief writes a binary snapshot of the list: a LariatSnapshotHeader, padding up to the
+ *        data offset, then the values of every node as raw blocks. The values end up packed,
+ *        so the snapshot doesn't depend on how full the nodes were.
+ * 
+ * @param os - binary stream to write to
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::save(std::ostream& os) const
+{
+    static_assert(std::is_trivially_copyable<T>::value, "snapshots need a trivially copyable type");
+
+    LariatSnapshotHeader header = {};
+
+    std::memcpy(header.magic, LariatSnapshotHeader::MAGIC, sizeof(header.magic));
+    header.version = LariatSnapshotHeader::FORMAT_VERSION;
+    header.byteOrder = LariatSnapshotHeader::ENDIAN_CHECK;
+    header.valueSize = sizeof(T);
+    header.nodeSize = asize_;
+    header.count = size_;
+
+    // the values start aligned, for the value type and for anything mapping the file
+    uint64_t alignment = std::max<uint64_t>(LariatSnapshotHeader::DATA_ALIGNMENT, alignof(T));
+
+    header.dataOffset = (sizeof(header) + alignment - 1) / alignment * alignment;
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    const char padding[LariatSnapshotHeader::DATA_ALIGNMENT] = {};
+
+    for(uint64_t written = sizeof(header); written < header.dataOffset; )
+    {
+        uint64_t block = std::min<uint64_t>(header.dataOffset - written, sizeof(padding));
+
+        os.write(padding, static_cast<std::streamsize>(block));
+        written += block;
+    }
+
+    for(LNode* walker = head_; walker != nullptr; walker = walker->next)
+    {
+        os.write(reinterpret_cast<const char*>(walker->data()), static_cast<std::streamsize>(sizeof(T) * walker->count));
+    }
+
+    if(!os)
+    {
+        throw LariatException(LariatException::E_DATA_ERROR, "Could not write the snapshot");
+    }
+}
+
+/**
+ * @brief writes a binary snapshot of the list to a file
+ * 
+ * @param path - file to write, replaced if it exists
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::save(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if(!file)
+    {
+        throw LariatException(LariatException::E_DATA_ERROR, "Could not open " + path);
+    }
+
+    save(file);
+
+    file.close();
+
+    if(!file)
+    {
+        throw LariatException(LariatException::E_DATA_ERROR, "Could not write " + path);
+    }
+}
+
+/**
+ * @brief replaces the contents of the list with a binary snapshot written by save. The
+ *        values are read straight into completely full nodes, a block per node. The
+ *        snapshot can come from a lariat of any Size. A bad header leaves the list as it
+ *        was, a truncated snapshot leaves it empty. The count in the header isn't trusted:
+ *        nodes are only reserved up front when a seekable stream holds all the values,
+ *        otherwise they are taken as the blocks are read.
+ * 
+ * @param is - binary stream to read from
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::load(std::istream& is)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "snapshots need a trivially copyable type");
+
+    LariatSnapshotHeader header;
+
+    if(!is.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    {
+        throw LariatException(LariatException::E_DATA_ERROR, "Snapshot is truncated");
+    }
+
+    header.check(sizeof(T));
+
+    // skip the padding
+    is.ignore(static_cast<std::streamsize>(header.dataOffset - sizeof(header)));
+
+    clear();
+
+    int count = static_cast<int>(header.count);
+
+    try
+    {
+        std::istream::pos_type here = is.tellg();
+
+        if(here != std::istream::pos_type(-1))
+        {
+            is.seekg(0, std::ios::end);
+
+            std::istream::pos_type end = is.tellg();
+
+            is.seekg(here);
+
+            if(end != std::istream::pos_type(-1) && static_cast<uint64_t>(end - here) < header.count * sizeof(T))
+            {
+                throw LariatException(LariatException::E_DATA_ERROR, "Snapshot is truncated");
+            }
+
+            reserve_nodes(nodes_for(count));
+        }
+
+        while(size_ < count)
+        {
+            int block = std::min(count - size_, asize_);
+
+            LNode* node = append_node();
+
+            is.read(reinterpret_cast<char*>(node->data()), static_cast<std::streamsize>(sizeof(T) * block));
+
+            if(is.gcount() != static_cast<std::streamsize>(sizeof(T) * block))
+            {
+                throw LariatException(LariatException::E_DATA_ERROR, "Snapshot is truncated");
+            }
+
+            node->count = block;
+            size_ += block;
+
+            index_update(node);
+        }
+    }
+    catch(...)
+    {
+        // don't keep the nodes a bad count made the pool take
+        clear();
+        shrink_to_fit();
+
+        throw;
+    }
+}
+
+/**
+ * @brief replaces the contents of the list with a binary snapshot file written by save
+ * 
+ * @param path - file to read
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if(!file)
+    {
+        throw LariatException(LariatException::E_DATA_ERROR, "Could not open " + path);
+    }
+
+    load(file);
+}
+
+/**
+ * @brief Constructs a value when the list is empty
+ * 
+ * @param args - arguments to construct the value with
+ */
+template<typename T, int Size>
+template<typename... Args>
+void Lariat<T, Size>::push_first_value(Args&&... args)
+{
+    // create the first node
+    LNode* newNode = allocate_node();
+
+    // construct the first value
+    try
+    {
+        new (&newNode->data()[0]) T(std::forward<Args>(args)...);
+    }
+    catch(...)
+    {
+        free_node(newNode);
+
+        throw;
+    }
+
+    // set its values
+    newNode->prev = nullptr;
+    newNode->next = nullptr;
+
+    // both the head and tail will be this first node
+    head_ = newNode;
+    tail_ = newNode;
+
+    newNode->count++;
+
+    // the first node is the whole index
+    index_insert_after(nullptr, newNode);
+
+    // update size counts
+    size_++;
+    nodecount_++;
+}
+
+/**
+ * @brief Constructs a value at the back of a specific node.
+ * 
+ * @param node - node to push value in
+ * @param args - arguments to construct the value with
+ */
+template<typename T, int Size>
+template<typename... Args>
+void Lariat<T, Size>::push_back_in_node(LNode* node, Args&&... args)
+{
+    if(node->count >= asize_)
+    {
+        node = split(node); // If the node doesn't have room, split it
+    }
+    else if(node->begin + node->count == asize_)
+    {
+        // the free slots are all before the values, move them down (a lone node keeps room at both ends)
+        rebase(node, node == head_ && node == tail_ ? (asize_ - node->count) / 2 : 0);
+    }
+
+    // Construct the value in the first free slot
+    new (&node->data()[node->count]) T(std::forward<Args>(args)...);
+    node->count++;
+    size_++;
+    index_update(node);
+}
+
+/**
+ * @brief Inserts a value in a node that has room, shifting the values before the local
+ *        index down or the values at and after it up to make a gap for it, whichever are fewer.
+ * 
+ * @param node - node to insert in
+ * @param localIndex - local index of node to insert
+ * @param value - value to move in
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::insert_in_node(LNode* node, int localIndex, T&& value)
+{
+    open_gap(node, localIndex);
+
+    // the gap is uninitialized, move construct the value in it
+    new (&node->data()[localIndex]) T(std::move(value));
+    node->count++;
+    size_++;
+    index_update(node);
+}
+
+/**
+ * @brief This insert a value in a full node. It will have to split the node to achieve this. 
+ *        The nodes end up as if the value was inserted and then the node was split.
+ * 
+ *        Let's say the node has values
+ *        1, 5, 6, 7, 8, 2, 3, 4
+ *        We want to insert 9 at local index 5 so it turns to
+ *        1, 5, 6, 7, 8 split 9, 2, 3, 4
+ * 
+ * @param node - node to insert
+ * @param localIndex - local index of node to insert
+ * @param value - value to insert
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::insert_in_full_node(LNode* node, int localIndex, T&& value)
+{
+    // Perform the split
+    LNode* splitNode = split(node); // 1, 5, 6, 7, 8 split 2, 3, 4
+
+    if(localIndex >= node->count)
+    {
+        // The value goes in the split node
+        insert_in_node(splitNode, localIndex - node->count, std::move(value)); // 1, 5, 6, 7, 8 split 9, 2, 3, 4
+    }
+    else
+    {
+        // The value goes in the original node, its last value goes to the front of the split node
+        shiftUp(splitNode, 0);
+        relocate_values(splitNode->data(), node->data() + node->count - 1, 1);
+        splitNode->count++;
+        node->count--;
+
+        index_update(splitNode);
+
+        insert_in_node(node, localIndex, std::move(value));
+    }
+}
+
+/**
+ * @brief Inserts values at the index one at a time from a source, filling the free slots of
+ *        the node at the index and then new nodes after it, so every node is touched once.
+ *        The values after the index are kept in their own node that goes after the new values.
+ * 
+ * @param index - index to insert the first value at
+ * @param done - returns true when the source has no more values
+ * @param construct - constructs the next value of the source in an uninitialized slot
+ */
+template<typename T, int Size>
+template<typename Done, typename Construct>
+void Lariat<T, Size>::insert_values(int index, Done done, Construct construct)
+{
+    // if the index is invalid, throw exception
+    if(index < 0 || index > size_)
+    {
+        throw LariatException(LariatException::E_BAD_INDEX, "Subscript is out of range");
+    }
+
+    if(done())
+    {
+        return;
+    }
+
+    LNode* node;
+    int localIndex;
+
+    if(head_ == nullptr)
+    {
+        // start the list with an empty node
+        node = append_node();
+        localIndex = 0;
+    }
+    else if(index == size_)
+    {
+        // append after the last value
+        node = tail_;
+        localIndex = tail_->count;
+    }
+    else
+    {
+        ElementInfo insertInfo = find_element(index);
+
+        node = insertInfo.node;
+        localIndex = insertInfo.localIndex;
+    }
+
+    // move the values after the index to their own node so the node can be filled from the index
+    LNode* rest = nullptr;
+
+    if(localIndex < node->count)
+    {
+        rest = split_node_at(node, localIndex);
+    }
+
+    LNode* current = node;
+
+    try
+    {
+        while(!done())
+        {
+            // start a new node when this one is full, one with free slots before its values is packed first
+            if(current->begin + current->count == asize_)
+            {
+                if(current->count < asize_)
+                {
+                    rebase(current, 0);
+                }
+                else
+                {
+                    index_update(current);
+
+                    current = insert_node_after(current);
+                }
+            }
+
+            construct(current->data() + current->count);
+
+            current->count++;
+            size_++;
+        }
+    }
+    catch(...)
+    {
+        // keep what was inserted so far
+        if(current->count == 0)
+        {
+            deleteNode(current);
+        }
+        else
+        {
+            index_update(current);
+        }
+
+        throw;
+    }
+
+    // put the values after the index back in the last node if they fit
+    if(rest != nullptr && current->count + rest->count <= asize_)
+    {
+        if(current->begin + current->count + rest->count > asize_)
+        {
+            rebase(current, 0);
+        }
+
+        relocate_values(current->data() + current->count, rest->data(), rest->count);
+
+        current->count += rest->count;
+        rest->count = 0;
+
+        deleteNode(rest);
+    }
+
+    index_update(current);
+}
+
+/**
+ * @brief appends a copy of every node of another lariat, block copying each node's values.
+ *        All the nodes come from one slab.
+ * 
+ * @param other - lariat to copy
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::copy_nodes(const Lariat& other)
+{
+    reserve_nodes(nodecount_ + other.nodecount_);
+
+    for(LNode* walker = other.head_; walker != nullptr; walker = walker->next)
+    {
+        LNode* node = append_node();
+
+        if constexpr(std::is_trivially_copyable<T>::value)
+        {
+            std::memcpy(static_cast<void*>(node->data()), static_cast<const void*>(walker->data()), sizeof(T) * walker->count);
+
+            node->count = walker->count;
+            size_ += walker->count;
+        }
+        else
+        {
+            // count as we go so a throwing copy leaves the node valid
+            for(int i = 0; i < walker->count; ++i)
+            {
+                new (node->data() + i) T(walker->data()[i]);
+
+                node->count++;
+                size_++;
+            }
+        }
+
+        index_update(node);
+    }
+}
+
+/**
+ * @brief creates an empty node at the end of the list.
+ * 
+ * @return - the new node
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::LNode* Lariat<T, Size>::append_node()
+{
+    if(tail_ != nullptr)
+    {
+        return insert_node_after(tail_);
+    }
+
+    // the first node is the head and tail
+    LNode* node = allocate_node();
+
+    head_ = node;
+    tail_ = node;
+    nodecount_++;
+
+    index_insert_after(nullptr, node);
+
+    return node;
+}
+
+/**
+ * @brief creates an empty node at the front of the list.
+ * 
+ * @return - the new node
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::LNode* Lariat<T, Size>::prepend_node()
+{
+    LNode* node = allocate_node();
+
+    node->next = head_;
+
+    if(head_ != nullptr)
+    {
+        head_->prev = node;
+    }
+    else
+    {
+        tail_ = node;
+    }
+
+    head_ = node;
+    nodecount_++;
+
+    index_insert_after(nullptr, node);
+
+    return node;
+}
+
+/**
+ * @brief moves the values of a node from a local index on into a new node linked after it.
+ * 
+ * @param node - node to split
+ * @param localIndex - local index of the first value to move
+ * @return - the new node
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::LNode* Lariat<T, Size>::split_node_at(LNode* node, int localIndex)
+{
+    LNode* rest = insert_node_after(node);
+
+    relocate_values(rest->data(), node->data() + localIndex, node->count - localIndex);
+
+    rest->count = node->count - localIndex;
+    node->count = localIndex;
+
+    index_update(node);
+    index_update(rest);
+
+    return rest;
+}
+
+/**
+ * @brief returns the node that starts at an index, splitting the node the index is in if
+ *        the index is in the middle of it
+ * 
+ * @param index - index of a value
+ * @return - the node whose first value is at the index
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::LNode* Lariat<T, Size>::node_boundary(int index)
+{
+    ElementInfo info = find_element(index);
+
+    if(info.localIndex == 0)
+    {
+        return info.node;
+    }
+
+    return split_node_at(info.node, info.localIndex);
+}
+
+/**
+ * @brief leaves the list empty without destroying or freeing its nodes, after another
+ *        list linked them into itself. The pool stays.
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::forget_nodes()
+{
+    head_ = nullptr;
+    tail_ = nullptr;
+    root_ = nullptr;
+    size_ = 0;
+    nodecount_ = 0;
+    finger_ = nullptr;
+    fingerBase_ = 0;
+    compactCursor_ = nullptr;
+}
+
+/**
+ * @brief creates an empty node and links it into the list directly after another node.
+ * 
+ * @param where - node that will be before the new node
+ * 
+ * @return - the new node
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::LNode* Lariat<T, Size>::insert_node_after(LNode* where)
+{
+    LNode* node = allocate_node();
+
+    node->prev = where;
+    node->next = where->next;
+
+    if(where->next != nullptr)
+    {
+        where->next->prev = node;
+    }
+    else
+    {
+        tail_ = node;
+    }
+
+    where->next = node;
+
+    nodecount_++;
+
+    index_insert_after(where, node);
+
+    return node;
+}
+
+/**
+ * @brief takes a full node and splits into two nodes of an aproximately 
+ *        equivalent number of elements.
+ * 
+ * @param node - the node to split
+ * 
+ * @return - returns the second node created as a result of the split
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::LNode* Lariat<T, Size>::split(LNode* node)
+{
+    bool isTail = node == tail_;
+
+    // The number of elements to move to the split node. If the count is even, keep an extra element in the original node,
+    // so when we add a value to the split node they will be approximately the same length. Tiny nodes are full at Size,
+    // so the move has a constant length
+    const int numSplit = TINY_NODES ? (Size - 1) / 2 : (node->count - 1) / 2;
+
+    // create the split node
+    LNode* splitNode = allocate_node();
+    LARIAT_COUNT(splits, 1);
+
+    // Move the elements into the split node
+    relocate_values(splitNode->data(), node->data() + node->count - numSplit, numSplit);
+
+    // Update the node counts
+    splitNode->count += numSplit;
+    node->count -= numSplit;
+
+    // Update the index with the smaller node and the new node after it
+    index_update(node);
+    index_insert_after(node, splitNode);
+
+    // Update the node values
+    splitNode->next = node->next;
+    node->next = splitNode;
+    splitNode->prev = node;
+
+    if(splitNode->next != nullptr)
+    {
+        splitNode->next->prev = splitNode;
+    }
+
+    nodecount_++;
+
+    // If we split the tail, update the tail
+    if(isTail)
+    {
+        tail_ = splitNode;
+    }
+
+    return splitNode;
+}
+
+/**
+ * @brief takes a global index to find in the list and returns both a pointer to the 
+ *        node in the list and the local index of the element in the returned node.
+ *        Looks in the node of the last lookup, its neighbors and the ends of the list
+ *        first, so sequential and nearby accesses don't descend the index.
+ * 
+ * @param index - global index to find
+ * @return struct with node and localindex of node
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::ElementInfo Lariat<T, Size>::find_element(int index)
+{
+    ElementInfo info;
+
+    if(finger_ != nullptr)
+    {
+        int localIndex = index - fingerBase_;
+
+        // the same node as last time
+        if(localIndex >= 0 && localIndex < finger_->count)
+        {
+            info.node = finger_;
+            info.localIndex = localIndex;
+
+            return info;
+        }
+
+        // the node after it
+        if(localIndex >= finger_->count && finger_->next != nullptr && localIndex - finger_->count < finger_->next->count)
+        {
+            fingerBase_ += finger_->count;
+            finger_ = finger_->next;
+            LARIAT_COUNT(findHops, 1);
+
+            info.node = finger_;
+            info.localIndex = index - fingerBase_;
+
+            return info;
+        }
+
+        // the node before it
+        if(localIndex < 0 && finger_->prev != nullptr && -localIndex <= finger_->prev->count)
+        {
+            finger_ = finger_->prev;
+            fingerBase_ -= finger_->count;
+            LARIAT_COUNT(findHops, 1);
+
+            info.node = finger_;
+            info.localIndex = index - fingerBase_;
+
+            return info;
+        }
+    }
+
+    // the ends of the list
+    if(index < head_->count)
+    {
+        finger_ = head_;
+        fingerBase_ = 0;
+
+        info.node = head_;
+        info.localIndex = index;
+
+        return info;
+    }
+
+    if(index >= root_->subtreeCount - tail_->count)
+    {
+        finger_ = tail_;
+        fingerBase_ = root_->subtreeCount - tail_->count;
+
+        info.node = tail_;
+        info.localIndex = index - fingerBase_;
+
+        return info;
+    }
+
+    info = index_find(index);
+
+    finger_ = info.node;
+    fingerBase_ = index - info.localIndex;
+
+    return info;
+}
+
+/**
+ * @brief descends the index to the node holding a global index. Doesn't use or move
+ *        the finger, so it is safe to call from several threads at once.
+ * 
+ * @param index - global index to find
+ * @return struct with node and localindex of node
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::ElementInfo Lariat<T, Size>::index_find(int index) const
+{
+    ElementInfo info;
+
+    LNode* walker = root_;
+
+    // Descend the index until we get to the node holding the index
+    while(true)
+    {
+        int leftCount = walker->left != nullptr ? walker->left->subtreeCount : 0;
+
+        if(index < leftCount)
+        {
+            // the element is in a node before this one
+            walker = walker->left;
+            LARIAT_COUNT(findHops, 1);
+        }
+        else if(index < leftCount + walker->count)
+        {
+            // the element is in this node
+            index -= leftCount;
+
+            break;
+        }
+        else
+        {
+            // the element is in a node after this one, skip the items before it
+            index -= leftCount + walker->count;
+
+            walker = walker->right;
+            LARIAT_COUNT(findHops, 1);
+        }
+    }
+
+    info.node = walker;
+    info.localIndex = index; // the items before the node are skipped already
+
+    return info;
+}
+
+/**
+ * @brief returns the index of the first value that before returns false for. The values
+ *        have to be partitioned, every value before returns true for comes first. The index
+ *        is ordered like the list, so descending it by the last value of each node finds
+ *        the first node that isn't completely before, and a binary search finds the value in it.
+ * 
+ * @param before - returns true for the values before the index
+ * @return - the index, size (one past last) if before is true for every value
+ */
+template<typename T, int Size>
+template<typename Before>
+unsigned Lariat<T, Size>::partition_index(Before before) const
+{
+    LNode* found = nullptr; // the first node seen that isn't completely before
+    int foundBase = 0;      // global index of the first element in found
+
+    LNode* walker = root_;
+    int base = 0;           // the number of items before the subtree of the walker
+
+    while(walker != nullptr)
+    {
+        int leftCount = walker->left != nullptr ? walker->left->subtreeCount : 0;
+
+        if(walker->count == 0 || before(walker->data()[walker->count - 1]))
+        {
+            // the whole node is before, the index is after it
+            base += leftCount + walker->count;
+
+            walker = walker->right;
+        }
+        else
+        {
+            // the index is in this node or one before it
+            found = walker;
+            foundBase = base + leftCount;
+
+            walker = walker->left;
+        }
+    }
+
+    if(found == nullptr)
+    {
+        return size_;
+    }
+
+    T* first = std::partition_point(found->data(), found->data() + found->count, before);
+
+    return foundBase + static_cast<int>(first - found->data());
+}
+
+/**
+ * @brief returns the index of the first value equal to a value in a block of values,
+ *        vectorized for arithmetic types.
+ * 
+ * @param values - values to search
+ * @param count - number of values
+ * @param value - value to find
+ * @return - index of the first match, count if there is none
+ */
+template<typename T, int Size>
+int Lariat<T, Size>::find_in_values(const T* values, int count, const T& value)
+{
+    if constexpr(lariat_simd::is_supported<T>::value && (Size == LARIAT_DYNAMIC_SIZE || Size >= lariat_simd::min_count))
+    {
+        // scan the whole block at once
+        return count >= lariat_simd::min_count ? lariat_simd::find(values, count, value) : 
+                                                 lariat_simd::find_scalar(values, count, value);
+    }
+    else
+    {
+        for(int i = 0; i < count; ++i)
+        {
+            if(values[i] == value)
+            {
+                return i;
+            }
+        }
+
+        return count;
+    }
+}
+
+/**
+ * @brief moves every element from the index onward up one in a single block move, 
+ *        leaving an uninitialized gap at the index. The node must have room.
+ * 
+ * @param node - node to shift
+ * @param localIndex - local index to start the shift at
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::shiftUp(LNode* node, int localIndex)
+{
+    relocate_values(node->data() + localIndex + 1, node->data() + localIndex, node->count - localIndex);
+    LARIAT_COUNT(shiftMoves, node->count - localIndex);
+}
+
+/**
+ * @brief moves each element after the local index down one in a single block move,
+ *        filling the uninitialized slot at the local index. The last slot is left uninitialized.
+ * 
+ * @param node - node to perform shift
+ * @param localIndex - local index to start shift
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::shiftDown(LNode* node, int localIndex)
+{
+    relocate_values(node->data() + localIndex, node->data() + localIndex + 1, node->count - 1 - localIndex);
+    LARIAT_COUNT(shiftMoves, node->count - 1 - localIndex);
+}
+
+/**
+ * @brief relocate_values for tiny nodes. Picks the memmove of the count from the memmoves of
+ *        every length a node can move, so each has a constant length.
+ * 
+ * @param destination - where the first value goes
+ * @param source - first value to move
+ * @param count - number of values to move, 1 to Size
+ */
+template<typename T, int Size>
+template<int... Counts>
+void Lariat<T, Size>::relocate_tiny(T* destination, T* source, int count, std::integer_sequence<int, Counts...>)
+{
+    (void)((count == Counts + 1 && (std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), sizeof(T) * (Counts + 1)), true)) || ...);
+}
+
+/**
+ * @brief opens an uninitialized gap at the local index, moving the values before it down
+ *        one or the values from it on up one, whichever are fewer and have a free slot
+ *        to move into. The node must have room.
+ * 
+ * @param node - node to open the gap in
+ * @param localIndex - local index of the gap
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::open_gap(LNode* node, int localIndex)
+{
+    bool roomAfter = node->begin + node->count < asize_;
+
+    if(node->begin > 0 && (localIndex < node->count - localIndex || !roomAfter))
+    {
+        relocate_values(node->data() - 1, node->data(), localIndex);
+        LARIAT_COUNT(shiftMoves, localIndex);
+
+        node->begin--;
+    }
+    else
+    {
+        shiftUp(node, localIndex);
+    }
+}
+
+/**
+ * @brief closes the uninitialized slot at the local index, moving the values before it up
+ *        one or the values after it down one, whichever are fewer.
+ * 
+ * @param node - node to close the slot in
+ * @param localIndex - local index of the slot
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::close_gap(LNode* node, int localIndex)
+{
+    if(localIndex < node->count - 1 - localIndex)
+    {
+        relocate_values(node->data() + 1, node->data(), localIndex);
+        LARIAT_COUNT(shiftMoves, localIndex);
+
+        node->begin++;
+    }
+    else
+    {
+        shiftDown(node, localIndex);
+    }
+}
+
+/**
+ * @brief moves the values of a node so the first one is in a slot. Used to make room at
+ *        one end of the node in a single block move.
+ * 
+ * @param node - node to move the values of
+ * @param begin - slot the first value goes in
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::rebase(LNode* node, int begin)
+{
+    if(node->begin == begin)
+    {
+        return;
+    }
+
+    relocate_values(node->values + begin, node->data(), node->count);
+    LARIAT_COUNT(shiftMoves, node->count);
+
+    node->begin = begin;
+}
+
+/**
+ * @brief moves a block of values into uninitialized slots, leaving the slots they came from
+ *        uninitialized. The ranges can overlap. Trivially copyable values are moved with a single
+ *        memmove, others are moved and destroyed in the direction that is safe for the overlap.
+ * 
+ * @param destination - where the first value goes
+ * @param source - first value to move
+ * @param count - number of values to move
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::relocate_values(T* destination, T* source, int count)
+{
+    // values moved onto themselves stay put, a move construct onto itself would empty them
+    if(count <= 0 || destination == source)
+    {
+        return;
+    }
+
+    if constexpr(TINY_NODES)
+    {
+        // at most Size values, a memmove of constant length for each count is inlined to a few loads and stores
+        relocate_tiny(destination, source, count, std::make_integer_sequence<int, Size>());
+    }
+    else if constexpr(std::is_trivially_copyable<T>::value)
+    {
+        std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), sizeof(T) * count);
+    }
+    else if(destination < source)
+    {
+        for(int i = 0; i < count; ++i)
+        {
+            new (destination + i) T(std::move(source[i]));
+            source[i].~T();
+        }
+    }
+    else
+    {
+        for(int i = count - 1; i >= 0; --i)
+        {
+            new (destination + i) T(std::move(source[i]));
+            source[i].~T();
+        }
+    }
+}
+
+/**
+ * @brief deletes a node
+ * 
+ * @param node - node to delete
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::deleteNode(LNode* node)
+{
+    if(node == nullptr)
+    {
+        return;
+    }
+
+    // take the node out of the index before unlinking it
+    index_erase(node);
+
+    // keep compact_step's cursor on a node that is in the list
+    if(node == compactCursor_)
+    {
+        compactCursor_ = node->prev;
+    }
+
+    if(node == head_)
+    {
+        // return if there is nothing to delete
+        if(head_ == nullptr)
+        {
+            return;
+        }
+
+        // if only the head exists
+        if(head_->next == nullptr)
+        {
+            // delete it and reset head and tail
+            free_node(head_);
+
+            head_ = nullptr;
+            tail_ = nullptr;
+        }
+        else
+        {
+            // otherwise, delete the head and set the head to its next
+            LNode* temp = head_->next;
+
+            free_node(head_);
+
+            head_ = temp;
+            head_->prev = nullptr;
+        }
+    }
+    else if(node == tail_)
+    {
+        LNode* temp = tail_->prev;
+
+        // set the node before the tail to its proper value
+        temp->next = nullptr;
+        tail_->next = nullptr;
+
+        free_node(tail_);
+
+        // set the tail to what its previous was
+        tail_ = temp;
+    }
+    else
+    {
+        // update the prev/next values of the node before and after
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+
+        // delete the node
+        free_node(node);
+    }
+
+    // a node was removed
+    nodecount_--;
+    LARIAT_COUNT(nodeFrees, 1);
+}
+
+/**
+ * @brief moves every value of the next node to the end of a node and deletes the next node,
+ *        if the values of both fit in one node.
+ * 
+ * @param node - node to merge the next node into
+ * @return true - the nodes were merged
+ * @return false - there is no next node or the values don't fit
+ */
+template<typename T, int Size>
+bool Lariat<T, Size>::merge_with_next(LNode* node)
+{
+    LNode* next = node->next;
+
+    if(next == nullptr || node->count + next->count > asize_)
+    {
+        return false;
+    }
+
+    if(node->begin + node->count + next->count > asize_)
+    {
+        rebase(node, 0);
+    }
+
+    relocate_values(node->data() + node->count, next->data(), next->count);
+    LARIAT_COUNT(compactMoves, next->count);
+
+    node->count += next->count;
+    next->count = 0;
+
+    index_update(node);
+    deleteNode(next);
+
+    return true;
+}
+
+/**
+ * @brief deletes every node after a node, the nodes must hold no items. They are split off
+ *        the index at once instead of being erased from it one at a time.
+ * 
+ * @param last - node that becomes the tail
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::delete_empty_tail(LNode* last)
+{
+    if(last->next == nullptr)
+    {
+        return;
+    }
+
+    // the empty nodes are after every item, so splitting the index after the items splits off exactly them
+    LNode* kept;
+    LNode* dropped;
+
+    index_split(root_, size_, kept, dropped);
+
+    root_ = kept;
+
+    for(LNode* walker = last->next; walker != nullptr; )
+    {
+        LNode* next = walker->next;
+
+        free_node(walker);
+        nodecount_--;
+        LARIAT_COUNT(nodeFrees, 1);
+
+        walker = next;
+    }
+
+    last->next = nullptr;
+    tail_ = last;
+    finger_ = nullptr;
+}
+
+/**
+ * @brief merges a node an erase left with fewer items than the merge threshold into the
+ *        node before it, or the node after it into it, whichever fits.
+ * 
+ * @param node - node an erase took values from
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::merge_after_erase(LNode* node)
+{
+    if(node->count >= mergeThreshold_)
+    {
+        return;
+    }
+
+    if(node->prev != nullptr && merge_with_next(node->prev))
+    {
+        return;
+    }
+
+    merge_with_next(node);
+}
+
+/**
+ * @brief takes a node from the pool. If the pool is empty, a new slab is carved with about
+ *        as many nodes as are already in the list so allocations stay rare as it grows.
+ * 
+ * @return an empty node
+ */
+template<typename T, int Size>
+typename Lariat<T, Size>::LNode* Lariat<T, Size>::allocate_node()
+{
+    if(freeNodes_ == nullptr)
+    {
+        // grow geometrically, but keep a slab around a megabyte at most
+        int maxNodes = static_cast<int>((1 << 20) / node_bytes());
+        int nodes = nodecount_ < 8 ? 8 : nodecount_;
+
+        if(nodes > maxNodes)
+        {
+            nodes = maxNodes > 0 ? maxNodes : 1;
+        }
+
+        allocate_slab(nodes);
+    }
+
+    LNode* node = freeNodes_;
+
+    freeNodes_ = node->next;
+    freecount_--;
+
+    // reset the links of the recycled node
+    node->next = nullptr;
+    node->prev = nullptr;
+    node->count = 0;
+    node->begin = 0;
+
+    LARIAT_COUNT(nodeAllocations, 1);
+
+    return node;
+}
+
+/**
+ * @brief destroys the values in a node and returns it to the pool so the next split can reuse it.
+ * 
+ * @param node - node to return
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::free_node(LNode* node)
+{
+    // only the first count values are constructed
+    for(int i = 0; i < node->count; ++i)
+    {
+        node->data()[i].~T();
+    }
+
+    node->next = freeNodes_;
+    node->prev = nullptr;
+    node->count = 0;
+
+    freeNodes_ = node;
+    freecount_++;
+}
+
+/**
+ * @brief carves a new slab of nodes and puts all of them in the pool.
+ * 
+ * @param nodes - number of nodes in the slab
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::allocate_slab(int nodes)
+{
+    // the nodes start after the slab header, aligned for a node
+    const size_t alignment = slab_alignment();
+    const size_t headerSize = (sizeof(NodeSlab) + alignment - 1) / alignment * alignment;
+    const size_t nodeBytes = node_bytes();
+
+    char* memory;
+
+    try
+    {
+        memory = static_cast<char*>(::operator new(headerSize + nodeBytes * nodes, std::align_val_t(alignment)));
+    }
+    catch(const std::bad_alloc& e)
+    {
+        throw LariatException(LariatException::E_NO_MEMORY, e.what());
+    }
+
+    NodeSlab* slab = new (memory) NodeSlab;
+
+    slab->nodes = 0;
+    slab->alignment = alignment;
+
+    char* nodeMemory = memory + headerSize;
+
+    try
+    {
+        // construct each node and put it in the pool
+        for(int i = 0; i < nodes; ++i)
+        {
+            LNode* node = new (nodeMemory + nodeBytes * i) LNode;
+
+            node->slab = slab;
+            slab->nodes++;
+
+            free_node(node);
+        }
+    }
+    catch(...)
+    {
+        // the slab is freed once the nodes that were made are released
+        if(slab->nodes == 0)
+        {
+            slab->~NodeSlab();
+            ::operator delete(memory, std::align_val_t(alignment));
+        }
+
+        throw;
+    }
+}
+
+/**
+ * @brief returns the bytes a node takes in a slab. A fixed Size node is an LNode, a
+ *        dynamic size node has its values running past the end of the LNode.
+ */
+template<typename T, int Size>
+size_t Lariat<T, Size>::node_bytes() const
+{
+    if constexpr(Size > 0)
+    {
+        return sizeof(LNode);
+    }
+    else
+    {
+        // the values run on from where they start in an LNode, keep the next node aligned
+        LNode probe;
+        size_t valuesOffset = static_cast<size_t>(reinterpret_cast<char*>(probe.values) - reinterpret_cast<char*>(&probe));
+        size_t bytes = valuesOffset + sizeof(T) * asize_;
+
+        return (bytes + alignof(LNode) - 1) / alignof(LNode) * alignof(LNode);
+    }
+}
+
+/**
+ * @brief returns the alignment of a new slab. Nodes that fill whole pages are page aligned
+ *        so each node sits in its own pages, others are aligned like a node.
+ */
+template<typename T, int Size>
+size_t Lariat<T, Size>::slab_alignment() const
+{
+    return node_bytes() % LARIAT_PAGE_SIZE == 0 ? LARIAT_PAGE_SIZE : alignof(LNode);
+}
+
+/**
+ * @brief returns the capacity of a dynamic size node when none is given, as many values
+ *        as fit in a page with the node header
+ */
+template<typename T, int Size>
+int Lariat<T, Size>::default_capacity()
+{
+    return lariat_page_capacity<T>();
+}
+
+/**
+ * @brief destroys a node and gives its memory back to its slab. The last node released
+ *        frees the slab. The count is atomic so lists that traded nodes can release them
+ *        from different threads.
+ * 
+ * @param node - node to release
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::release_node(LNode* node)
+{
+    NodeSlab* slab = node->slab;
+
+    node->~LNode();
+
+    if(--slab->nodes == 0)
+    {
+        size_t alignment = slab->alignment;
+
+        slab->~NodeSlab();
+        ::operator delete(static_cast<void*>(slab), std::align_val_t(alignment));
+    }
+}
+
+/**
+ * @brief adds a node to the index directly after another node. The index is a treap
+ *        ordered the same as the list, where every node also stores the number of items
+ *        in its subtree, so an index lookup only visits O(log nodes) nodes.
+ * 
+ * @param where - node that will be before the new node in the list. null to add it at the front
+ * @param node - node to add
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::index_insert_after(LNode* where, LNode* node)
+{
+    // items added before the finger move it
+    if(where != finger_ && node->count != 0)
+    {
+        finger_ = nullptr;
+    }
+
+    node->left = nullptr;
+    node->right = nullptr;
+    node->subtreeCount = node->count;
+    node->subtreeNodes = 1;
+
+    // if the index is empty, the node is the whole index
+    if(root_ == nullptr)
+    {
+        node->parent = nullptr;
+        root_ = node;
+
+        return;
+    }
+
+    LNode* parent;
+
+    if(where == nullptr)
+    {
+        // the new first node goes left of the current first node
+        parent = root_;
+
+        while(parent->left != nullptr)
+        {
+            parent = parent->left;
+        }
+
+        parent->left = node;
     }
+    else if(where->right == nullptr)
+    {
+        // directly right of where
+        parent = where;
 
-    Lariat<T, Size>::ElementInfo elementInfo = find_element(index);
+        parent->right = node;
+    }
+    else
+    {
+        // otherwise left of the node that was after where
+        parent = where->right;
 
-    // Shift all the elements in the node beyond the local index left one element, covering the element being erased.
-    shiftDown(elementInfo.node, elementInfo.localIndex);
+        while(parent->left != nullptr)
+        {
+            parent = parent->left;
+        }
 
-    // update count and size values
-    elementInfo.node->count--;
-    size_--;
+        parent->left = node;
+    }
 
-    // delete the node if it's empty
-    if(elementInfo.node->count == 0)
+    node->parent = parent;
+
+    // every node above the new node now holds its items too
+    for(LNode* walker = parent; walker != nullptr; walker = walker->parent)
     {
-        deleteNode(elementInfo.node);
+        walker->subtreeCount += node->count;
+        walker->subtreeNodes++;
+    }
+
+    // rotate the node up until the priorities are in heap order again
+    while(node->parent != nullptr && index_priority(node->parent) < index_priority(node))
+    {
+        index_rotate_up(node);
     }
 }
 
 /**
- * @brief delete the last value in the container
+ * @brief removes a node from the index.
+ * 
+ * @param node - node to remove
  */
 template<typename T, int Size>
-void Lariat<T, Size>::pop_back()
+void Lariat<T, Size>::index_erase(LNode* node)
 {
-    // update count and size values
-    tail_->count--;
-    size_--;
+    // the items the index still counts for the node, its count can already be 0
+    int indexedCount = node->subtreeCount - (node->left != nullptr ? node->left->subtreeCount : 0) - 
+                                            (node->right != nullptr ? node->right->subtreeCount : 0);
 
-    // delete the tail if it's empty
-    if(tail_->count == 0)
+    // the finger is going away, or items before it are
+    if(finger_ != nullptr && (node == finger_ || (indexedCount != 0 && node != finger_->next)))
     {
-        deleteNode(tail_);
+        finger_ = nullptr;
     }
-}
 
-/**
- * @brief delete the first value in the container
- */
-template<typename T, int Size>
-void Lariat<T, Size>::pop_front()
-{
-    if(head_ == nullptr)
-        return;
+    // rotate the node down until it has at most one child
+    while(node->left != nullptr && node->right != nullptr)
+    {
+        index_rotate_up(index_priority(node->left) > index_priority(node->right) ? node->left : node->right);
+    }
 
-    // Shift all elements from the first value down
-    shiftDown(head_, 0);
+    LNode* child = node->left != nullptr ? node->left : node->right;
+    LNode* parent = node->parent;
 
-    // update count and size values
-    head_->count--;
-    size_--;
+    // replace the node with its only child
+    if(child != nullptr)
+    {
+        child->parent = parent;
+    }
 
-    // delete the head if it's empty
-    if(head_->count == 0)
+    if(parent == nullptr)
     {
-        deleteNode(head_);
+        root_ = child;
+    }
+    else if(parent->left == node)
+    {
+        parent->left = child;
+    }
+    else
+    {
+        parent->right = child;
     }
-}
 
-/**
- * @brief Index operator
- * @param index - index to get
- */
-template<typename T, int Size>
-T& Lariat<T, Size>::operator[](int index)
-{
-    Lariat<T, Size>::ElementInfo elementInfo = find_element(index);
+    node->parent = nullptr;
+    node->left = nullptr;
+    node->right = nullptr;
 
-    return elementInfo.node->values[elementInfo.localIndex];
+    // the nodes above no longer hold its items
+    for(LNode* walker = parent; walker != nullptr; walker = walker->parent)
+    {
+        index_recalculate(walker);
+    }
 }
 
 /**
- * @brief Index operator
- * @param index - index to get
+ * @brief recalculates the item counts of a node and every node above it in the index. 
+ *        Must be called whenever the count of a node changes.
+ * 
+ * @param node - node whose count changed
  */
 template<typename T, int Size>
-const T& Lariat<T, Size>::operator[](int index) const
+void Lariat<T, Size>::index_update(LNode* node)
 {
-    Lariat<T, Size>::ElementInfo elementInfo = find_element(index);
+    // only the finger and the node right after it can change without moving the finger
+    if(finger_ != nullptr && node != finger_ && node != finger_->next)
+    {
+        finger_ = nullptr;
+    }
 
-    return elementInfo.node->values[elementInfo.localIndex];
+    while(node != nullptr)
+    {
+        index_recalculate(node);
+
+        node = node->parent;
+    }
 }
 
 /**
- * @brief returns the first value of the container
+ * @brief recalculates the item counts of every node in the index below and including node.
+ *        Used after an operation that changes the count of many nodes at once.
+ * 
+ * @param node - the top node to recount
  */
 template<typename T, int Size>
-T& Lariat<T, Size>::first()
+void Lariat<T, Size>::index_recount(LNode* node)
 {
-    return head_->values[0];
+    // many counts changed, the finger can't be trusted
+    finger_ = nullptr;
+
+    if(node == nullptr)
+    {
+        return;
+    }
+
+    index_recount(node->left);
+    index_recount(node->right);
+
+    index_recalculate(node);
 }
 
 /**
- * @brief returns the first value of the container
+ * @brief rotates a node above its parent in the index, keeping the list order.
+ * 
+ * @param node - node to rotate up
  */
 template<typename T, int Size>
-const T& Lariat<T, Size>::first() const
+void Lariat<T, Size>::index_rotate_up(LNode* node)
 {
-    return head_->values[0];
+    LNode* parent = node->parent;
+    LNode* grandparent = parent->parent;
+
+    if(parent->left == node)
+    {
+        // the node's right subtree becomes the parent's left subtree
+        parent->left = node->right;
+
+        if(node->right != nullptr)
+        {
+            node->right->parent = parent;
+        }
+
+        node->right = parent;
+    }
+    else
+    {
+        // the node's left subtree becomes the parent's right subtree
+        parent->right = node->left;
+
+        if(node->left != nullptr)
+        {
+            node->left->parent = parent;
+        }
+
+        node->left = parent;
+    }
+
+    parent->parent = node;
+    node->parent = grandparent;
+
+    // link the node where the parent was
+    if(grandparent == nullptr)
+    {
+        root_ = node;
+    }
+    else if(grandparent->left == parent)
+    {
+        grandparent->left = node;
+    }
+    else
+    {
+        grandparent->right = node;
+    }
+
+    // the parent is now below the node, so recount it first
+    index_recalculate(parent);
+
+    index_recalculate(node);
 }
 
 /**
- * @brief returns the last value of the container
+ * @brief recalculates the item and node counts of a node from its own count and its
+ *        children in the index.
+ * 
+ * @param node - node to recalculate
  */
 template<typename T, int Size>
-T& Lariat<T, Size>::last()
+void Lariat<T, Size>::index_recalculate(LNode* node)
 {
-    return tail_->values[tail_->count - 1];
+    node->subtreeCount = node->count;
+    node->subtreeNodes = 1;
+
+    if(node->left != nullptr)
+    {
+        node->subtreeCount += node->left->subtreeCount;
+        node->subtreeNodes += node->left->subtreeNodes;
+    }
+
+    if(node->right != nullptr)
+    {
+        node->subtreeCount += node->right->subtreeCount;
+        node->subtreeNodes += node->right->subtreeNodes;
+    }
 }
 
 /**
- * @brief returns the last value of the container
+ * @brief joins two indexes, where every node of the first is before every node of the
+ *        second in the list. The root with the higher priority stays on top and the other
+ *        index is joined into its inner side, so the heap order holds. O(log nodes).
+ * 
+ * @param first - root of the index of the nodes that come first, can be null
+ * @param second - root of the index of the nodes that come after, can be null
+ * @return - root of the joined index
  */
 template<typename T, int Size>
-const T& Lariat<T, Size>::last() const
+typename Lariat<T, Size>::LNode* Lariat<T, Size>::index_join(LNode* first, LNode* second)
 {
-    return tail_->values[tail_->count - 1];
+    if(first == nullptr)
+    {
+        return second;
+    }
+
+    if(second == nullptr)
+    {
+        return first;
+    }
+
+    LNode* root;
+
+    if(index_priority(first) > index_priority(second))
+    {
+        root = first;
+
+        first->right = index_join(first->right, second);
+        first->right->parent = first;
+    }
+    else
+    {
+        root = second;
+
+        second->left = index_join(first, second->left);
+        second->left->parent = second;
+    }
+
+    index_recalculate(root);
+
+    root->parent = nullptr;
+
+    return root;
 }
 
 /**
- * @brief Walks through the list and finds the index of matching value
+ * @brief splits an index into the nodes before a global index and the nodes from it on.
+ *        The index has to be where a node starts. O(log nodes).
  * 
- * @param value - value to find
- * @return index of the value. if it can't find found, returns the size of the list.
+ * @param node - root of the index to split, can be null
+ * @param index - global index of the first element of the nodes that go to second
+ * @param first - set to the root of the index of the nodes before the index
+ * @param second - set to the root of the index of the nodes from the index on
  */
 template<typename T, int Size>
-unsigned Lariat<T, Size>::find(const T& value) const
+void Lariat<T, Size>::index_split(LNode* node, int index, LNode*& first, LNode*& second)
 {
-    LNode* walker = head_;
+    if(node == nullptr)
+    {
+        first = nullptr;
+        second = nullptr;
 
-    int index = 0;
+        return;
+    }
 
-    while(walker != nullptr)
+    int leftCount = node->left != nullptr ? node->left->subtreeCount : 0;
+
+    if(index <= leftCount)
     {
-        // go through every value in the node
-        for(int i = 0; i < walker->count; ++i, ++index)
+        // the node is after the index, split its left subtree
+        index_split(node->left, index, first, node->left);
+
+        if(node->left != nullptr)
         {
-            // if the value matches, return
-            if(walker->values[i] == value)
-            {
-                return index;
-            }
+            node->left->parent = node;
         }
 
-        walker = walker->next;
+        second = node;
+    }
+    else
+    {
+        // the node is before the index, split its right subtree
+        index_split(node->right, index - leftCount - node->count, node->right, second);
+
+        if(node->right != nullptr)
+        {
+            node->right->parent = node;
+        }
+
+        first = node;
     }
 
-    // otherwise return the size of the list
-    return size_;
+    index_recalculate(node);
+
+    node->parent = nullptr;
 }
 
 /**
- * @brief returns the size of the list
+ * @brief returns the heap priority of a node in the index, a hash of its address (the
+ *        murmur3 finalizer). It takes no room in the node header and doesn't change while
+ *        the node is in the index.
  */
 template<typename T, int Size>
-size_t Lariat<T, Size>::size(void) const
+unsigned Lariat<T, Size>::index_priority(const LNode* node)
 {
-    return size_;
+    uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(node));
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return static_cast<unsigned>(hash);
 }
 
 /**
- * @brief deletes and clears every node in the list
+ * @brief returns the global index of the first element in a node by walking up the index
+ * 
+ * @param node - node to find the index of
  */
 template<typename T, int Size>
-void Lariat<T, Size>::clear(void)
+int Lariat<T, Size>::index_of(const LNode* node)
 {
-    LNode* walker = head_;
+    int index = node->left != nullptr ? node->left->subtreeCount : 0;
 
-    // walk through the list
-    while(walker != nullptr)
+    // every time we come up from the right, the parent and its left subtree are before the node
+    for(const LNode* walker = node; walker->parent != nullptr; walker = walker->parent)
     {
-        // delete all nodes
-        LNode* next = walker->next;
-
-        delete walker;
-
-        walker = next;
+        if(walker->parent->right == walker)
+        {
+            index += walker->parent->count + (walker->parent->left != nullptr ? walker->parent->left->subtreeCount : 0);
+        }
     }
 
-    // reset values
-    size_ = 0;
-    nodecount_ = 0;
+    return index;
+}
+
+/**
+ * @brief Construct an iterator that doesn't point into any container
+ */
+template<typename T, int Size>
+template<typename Value>
+Lariat<T, Size>::Iterator<Value>::Iterator() : node_(nullptr), localIndex_(0)
+{
 
-    head_ = nullptr;
-    tail_ = nullptr;
 }
 
 /**
- * @brief Compact takes all the data stored in the linked list and moves it into the
-          smallest number of nodes possible. Then it frees all empty nodes at the
-          end of the list.
+ * @brief Construct an iterator at an element of a node
  * 
+ * @param node - node the element is in
+ * @param localIndex - index of the element in the node
  */
 template<typename T, int Size>
-void Lariat<T, Size>::compact()
+template<typename Value>
+Lariat<T, Size>::Iterator<Value>::Iterator(LNode* node, int localIndex) : node_(node), localIndex_(localIndex)
 {
-    if(head_ == nullptr)
-    {
-        return;
-    }
-
-    LNode* leftFoot = head_;
-    LNode* rightFoot = head_->next;
 
-    // loop through the list with both feet until the left node is not already full and the right foot hasn't walked off the list.
-    while(leftFoot->count == asize_ && rightFoot != nullptr)
-    {
-        leftFoot = leftFoot->next;
-        rightFoot = rightFoot->next;
-    }
+}
 
-    // walk through the list while the right foot hasn't lost the list.
-    while(rightFoot != nullptr)
-    {
-        int rightFootCount = rightFoot->count;
+/**
+ * @brief Converts an iterator to a const iterator
+ * 
+ * @param other - iterator to convert
+ */
+template<typename T, int Size>
+template<typename Value>
+template<typename OtherValue, typename>
+Lariat<T, Size>::Iterator<Value>::Iterator(const Iterator<OtherValue>& other) : node_(other.node_), localIndex_(other.localIndex_)
+{
 
-        rightFoot->count = 0;
+}
 
-        // step the left foot to the next node if it is full
-        if(leftFoot->count == asize_)
-        {
-            leftFoot = leftFoot->next;
-        }
+/**
+ * @brief returns the element the iterator is at
+ */
+template<typename T, int Size>
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value>::reference Lariat<T, Size>::Iterator<Value>::operator*() const
+{
+    return node_->data()[localIndex_];
+}
 
-        for(int i = 0; i < rightFootCount; ++i)
-        {
-            // move the values from the right foot to the left foot
-            leftFoot->values[leftFoot->count] = rightFoot->values[i];
-            leftFoot->count++;
+/**
+ * @brief returns a pointer to the element the iterator is at
+ */
+template<typename T, int Size>
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value>::pointer Lariat<T, Size>::Iterator<Value>::operator->() const
+{
+    return &node_->data()[localIndex_];
+}
 
-            // step the left foot to the next node if it is full
-            if(leftFoot->count == asize_)
-            {
-                leftFoot = leftFoot->next;
-            }
-        }
+/**
+ * @brief returns the element n places from the iterator
+ * 
+ * @param n - number of elements to move
+ */
+template<typename T, int Size>
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value>::reference Lariat<T, Size>::Iterator<Value>::operator[](difference_type n) const
+{
+    return *(*this + n);
+}
 
-        rightFoot = rightFoot->next;
-    }
+/**
+ * @brief steps to the next element, only following next at the end of a node
+ */
+template<typename T, int Size>
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value>& Lariat<T, Size>::Iterator<Value>::operator++()
+{
+    ++localIndex_;
 
-    // remove all the extra nodes from the end of the list
-    while(tail_->count == 0)
+    // go to the start of the next node, the tail stays at one past its last element for end()
+    if(localIndex_ == node_->count && node_->next != nullptr)
     {
-        deleteNode(tail_);
+        node_ = node_->next;
+        localIndex_ = 0;
     }
+
+    return *this;
 }
 
 /**
- * @brief Pushes a value when the list is empty
- * 
- * @param value - value to push
+ * @brief steps to the next element and returns the iterator before the step
  */
 template<typename T, int Size>
-void Lariat<T, Size>::push_first_value(const T& value)
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value> Lariat<T, Size>::Iterator<Value>::operator++(int)
 {
-    LNode* newNode;
+    Iterator copy = *this;
 
-    // create the first node
-    try
+    ++*this;
+
+    return copy;
+}
+
+/**
+ * @brief steps to the previous element, only following prev at the start of a node
+ */
+template<typename T, int Size>
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value>& Lariat<T, Size>::Iterator<Value>::operator--()
+{
+    if(localIndex_ == 0)
     {
-        newNode = new LNode;
+        // go to the last element of the previous node
+        node_ = node_->prev;
+        localIndex_ = node_->count - 1;
     }
-    catch(const std::bad_alloc& e)
+    else
     {
-        throw LariatException(LariatException::E_NO_MEMORY, e.what());
+        --localIndex_;
     }
 
-    // set its values
-    newNode->prev = nullptr;
-    newNode->next = nullptr;
-
-    // both the head and tail will be this first node
-    head_ = newNode;
-    tail_ = newNode;
+    return *this;
+}
 
-    // assign the first value
-    newNode->values[tail_->count] = value;
+/**
+ * @brief steps to the previous element and returns the iterator before the step
+ */
+template<typename T, int Size>
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value> Lariat<T, Size>::Iterator<Value>::operator--(int)
+{
+    Iterator copy = *this;
 
-    newNode->count++;
+    --*this;
 
-    // update size counts
-    size_++;
-    nodecount_++;
+    return copy;
 }
 
 /**
- * @brief Pushes back a value in a specific node.
+ * @brief moves the iterator n elements, skipping whole nodes using their counts
  * 
- * @param node - node to push value in
- * @param value - value to push
+ * @param n - number of elements to move, can be negative
  */
 template<typename T, int Size>
-void Lariat<T, Size>::push_back_in_node(LNode* node, const T& value)
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value>& Lariat<T, Size>::Iterator<Value>::operator+=(difference_type n)
 {
-    if(node->count >= asize_)
+    if(n >= 0)
     {
-        node = split(node); // If the node doesn't have room, split it
+        // skip the rest of each node while the move goes past it
+        while(n >= node_->count - localIndex_ && node_->next != nullptr)
+        {
+            n -= node_->count - localIndex_;
+
+            node_ = node_->next;
+            localIndex_ = 0;
+        }
+
+        localIndex_ += static_cast<int>(n);
     }
+    else
+    {
+        n = -n;
 
-    // Push the value
-    node->values[node->count] = value;
-    node->count++;
-    size_++;
+        // skip the start of each node while the move goes before it
+        while(n > localIndex_)
+        {
+            n -= localIndex_ + 1;
+
+            node_ = node_->prev;
+            localIndex_ = node_->count - 1;
+        }
+
+        localIndex_ -= static_cast<int>(n);
+    }
+
+    return *this;
 }
 
 /**
- * @brief This insert a value in a full node. It will have to split the node to achieve this. The function has documentation next to each step of how the
- *        node values change.
+ * @brief moves the iterator back n elements
  * 
- *        Let's say the node has values
- *        1, 5, 6, 7, 8, 2, 3, 4
- *        We want to insert 9 at local index 5 so it turns to
- *        1, 5, 6, 7, 8 split 9, 2, 3, 4
+ * @param n - number of elements to move, can be negative
+ */
+template<typename T, int Size>
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value>& Lariat<T, Size>::Iterator<Value>::operator-=(difference_type n)
+{
+    return *this += -n;
+}
+
+/**
+ * @brief returns an iterator n elements after this one
  * 
- * @param node - node to insert
- * @param localIndex - local index of node to insert
- * @param value - value to insert
+ * @param n - number of elements to move
  */
 template<typename T, int Size>
-void Lariat<T, Size>::insert_in_full_node(LNode* node, int localIndex, const T& value)
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value> Lariat<T, Size>::Iterator<Value>::operator+(difference_type n) const
 {
-    // Put the last value in list at the correct index and shift all subsequent values up
-    shiftUp(node, localIndex); // 1, 5, 6, 7, 8, 4, 2, 3
+    Iterator copy = *this;
 
-    // Get the overflow value
-    T overflow = node->values[localIndex]; // overflow = 4
-    
-    // Set the value at index to correct value
-    node->values[localIndex] = value; // 1, 5, 6, 7, 8, 9, 2, 3
+    return copy += n;
+}
 
-    // Perform the split
-    LNode* splitNode = split(node); // 1, 5, 6, 7, 8 split 9, 2, 3
+/**
+ * @brief returns an iterator n elements before this one
+ * 
+ * @param n - number of elements to move
+ */
+template<typename T, int Size>
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value> Lariat<T, Size>::Iterator<Value>::operator-(difference_type n) const
+{
+    Iterator copy = *this;
 
-    // Push the overflow value back into the split node
-    push_back_in_node(splitNode, overflow); // 1, 5, 6, 7, 8 split 9, 2, 3, 4
+    return copy -= n;
 }
 
 /**
- * @brief takes a full node and splits into two nodes of an aproximately 
- *        equivalent number of elements.
- * 
- * @param node - the node to split
+ * @brief returns the number of elements between two iterators
  * 
- * @return - returns the second node created as a result of the split
+ * @param other - iterator to measure from
  */
 template<typename T, int Size>
-typename Lariat<T, Size>::LNode* Lariat<T, Size>::split(LNode* node)
+template<typename Value>
+template<typename OtherValue>
+typename Lariat<T, Size>::template Iterator<Value>::difference_type Lariat<T, Size>::Iterator<Value>::operator-(const Iterator<OtherValue>& other) const
 {
-    bool isTail = node == tail_;
+    return position() - other.position();
+}
+
+/**
+ * @brief returns whether two iterators are at the same element
+ */
+template<typename T, int Size>
+template<typename Value>
+template<typename OtherValue>
+bool Lariat<T, Size>::Iterator<Value>::operator==(const Iterator<OtherValue>& other) const
+{
+    return node_ == other.node_ && localIndex_ == other.localIndex_;
+}
 
-    int numSplit = node->count / 2; // The number of elements to move to the split node
+/**
+ * @brief returns whether two iterators are at different elements
+ */
+template<typename T, int Size>
+template<typename Value>
+template<typename OtherValue>
+bool Lariat<T, Size>::Iterator<Value>::operator!=(const Iterator<OtherValue>& other) const
+{
+    return !(*this == other);
+}
 
-    // if it's even, keep an extra element in the origianal node. this is so when we add a value to the split node, they will be approximately same length.
-    if(node->count % 2 == 0)
+/**
+ * @brief returns whether this iterator is before the other
+ */
+template<typename T, int Size>
+template<typename Value>
+template<typename OtherValue>
+bool Lariat<T, Size>::Iterator<Value>::operator<(const Iterator<OtherValue>& other) const
+{
+    // in the same node we don't need the index
+    if(node_ == other.node_)
     {
-        numSplit -= 1;
+        return localIndex_ < other.localIndex_;
     }
 
-    LNode* splitNode;
+    return position() < other.position();
+}
 
-    // create the split node
-    try
-    {
-        splitNode = new LNode;
-    }
-    catch(const std::bad_alloc& e)
-    {
-        throw LariatException(LariatException::E_NO_MEMORY, e.what());
-    }
+/**
+ * @brief returns whether this iterator is after the other
+ */
+template<typename T, int Size>
+template<typename Value>
+template<typename OtherValue>
+bool Lariat<T, Size>::Iterator<Value>::operator>(const Iterator<OtherValue>& other) const
+{
+    return other < *this;
+}
 
-    // Move the elements into the split node
-    for(int i = node->count - numSplit, j = 0; i < node->count; ++i, ++j)
+/**
+ * @brief returns whether this iterator is before or at the other
+ */
+template<typename T, int Size>
+template<typename Value>
+template<typename OtherValue>
+bool Lariat<T, Size>::Iterator<Value>::operator<=(const Iterator<OtherValue>& other) const
+{
+    return !(other < *this);
+}
+
+/**
+ * @brief returns whether this iterator is after or at the other
+ */
+template<typename T, int Size>
+template<typename Value>
+template<typename OtherValue>
+bool Lariat<T, Size>::Iterator<Value>::operator>=(const Iterator<OtherValue>& other) const
+{
+    return !(*this < other);
+}
+
+/**
+ * @brief returns the global index of the element the iterator is at
+ */
+template<typename T, int Size>
+template<typename Value>
+typename Lariat<T, Size>::template Iterator<Value>::difference_type Lariat<T, Size>::Iterator<Value>::position() const
+{
+    if(node_ == nullptr)
     {
-        splitNode->values[j] = node->values[i];
+        return 0;
     }
 
-    // Update the node counts
-    splitNode->count += numSplit;
-    node->count -= numSplit;
+    return Lariat<T, Size>::index_of(node_) + localIndex_;
+}
 
-    // Update the node values
-    splitNode->next = node->next;
-    node->next = splitNode;
-    splitNode->prev = node;
+/**
+ * @brief Construct an appender for the back of a list, no window is open yet
+ *
+ * @param list - list to append to
+ */
+template<typename T, int Size>
+Lariat<T, Size>::Appender::Appender(Lariat& list) : list_(list), cursor_(nullptr), room_(0), pending_(0)
+{
 
-    if(splitNode->next != nullptr)
-    {
-        splitNode->next->prev = splitNode;
-    }
+}
 
-    nodecount_++;
+/**
+ * @brief Destroy the appender, the values written so far join the list
+ */
+template<typename T, int Size>
+Lariat<T, Size>::Appender::~Appender()
+{
+    flush();
+}
 
-    // If we split the tail, update the tail
-    if(isTail)
+/**
+ * @brief returns the free slots at the back of the list as raw storage the caller can
+ *        construct values in, or parse straight into for trivially copyable types. Opens
+ *        a new tail when the tail is full, so there is always at least one slot. Only
+ *        valid until the next call on the appender.
+ *
+ * @param count - set to the number of free slots
+ * @return - the first free slot
+ */
+template<typename T, int Size>
+T* Lariat<T, Size>::Appender::window(int& count)
+{
+    if(room_ == 0)
     {
-        tail_ = splitNode;
+        flush();
+        open_window();
     }
 
-    return splitNode;
+    count = room_;
+
+    return cursor_;
 }
 
 /**
- * @brief takes a global index to find in the list and returns both a pointer to the 
- *        node in the list and the local index of the element in the returned node.
- * 
- * @param index - global index to find
- * @return struct with node and localindex of node
+ * @brief adds the values the caller constructed in the first slots of the window to
+ *        the list
+ *
+ * @param count - number of values constructed, at most the count window returned
  */
 template<typename T, int Size>
-typename Lariat<T, Size>::ElementInfo Lariat<T, Size>::find_element(int index)
+void Lariat<T, Size>::Appender::commit(int count)
 {
-    ElementInfo info;
+    if(count < 0 || count > room_)
+    {
+        throw LariatException(LariatException::E_BAD_INDEX, "Commit is larger than the window");
+    }
 
-    int indexSum = 0; // Keeps track of the sum of the index size as we walk through the list
+    cursor_ += count;
+    room_ -= count;
+    pending_ += count;
 
-    LNode* walker = head_;
+    flush();
+}
 
-    // Walk until we get to the node
-    while (indexSum + walker->count <= index)
+/**
+ * @brief Construct a value at the back. It joins the list when the appender flushes.
+ *
+ * @param args - arguments to construct the value with
+ */
+template<typename T, int Size>
+template<typename... Args>
+void Lariat<T, Size>::Appender::emplace(Args&&... args)
+{
+    if(room_ == 0)
     {
-        indexSum += walker->count;
-
-        walker = walker->next;
+        flush();
+        open_window();
     }
 
-    info.node = walker;
-    info.localIndex = index - indexSum; // Calculate the local index
+    new (cursor_) T(std::forward<Args>(args)...);
 
-    return info;
+    cursor_++;
+    room_--;
+    pending_++;
 }
 
 /**
- * @brief swaps every element between the index and the last element in the node's array
-          in place.
- * 
- * @param node - node to shift
- * @param localIndex - local index to start the shift at
+ * @brief push a copy of a value to the back
+ *
+ * @param value - value to push
  */
 template<typename T, int Size>
-void Lariat<T, Size>::shiftUp(LNode* node, int localIndex)
+void Lariat<T, Size>::Appender::push(const T& value)
+{
+    emplace(value);
+}
+
+/**
+ * @brief push a value to the back by moving it
+ *
+ * @param value - value to move in
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::Appender::push(T&& value)
+{
+    emplace(std::move(value));
+}
+
+/**
+ * @brief push every value from first to last to the back
+ *
+ * @param first - first value
+ * @param last - one past the last value
+ */
+template<typename T, int Size>
+template<typename InputIt>
+void Lariat<T, Size>::Appender::append(InputIt first, InputIt last)
 {
-    for(int i = localIndex + 1; i < node->count; ++i)
+    for(; first != last; ++first)
     {
-        // swap every element from the local index value onward with the local index value
-        T temp = node->values[localIndex];
-        node->values[localIndex] = node->values[i];
-        node->values[i] = temp;
+        emplace(*first);
     }
 }
 
 /**
- * @brief swaps each element from local index onward with the element immediately before it.
- * 
- * @param node - node to perform shift
- * @param localIndex - local index to start shift
+ * @brief push every value of a range to the back. The range is walked once, so a
+ *        generator coroutine can produce the values as they are appended.
+ *
+ * @param range - anything a range for loop can walk
  */
 template<typename T, int Size>
-void Lariat<T, Size>::shiftDown(LNode* node, int localIndex)
+template<typename Range>
+void Lariat<T, Size>::Appender::append(Range&& range)
 {
-    for(int i = localIndex; i < node->count; ++i)
+    for(auto&& value : range)
     {
-        // swap every node with the one before it
-        node->values[i] = node->values[i + 1];
+        emplace(std::forward<decltype(value)>(value));
     }
 }
 
 /**
- * @brief deletes a node
- * 
- * @param node - node to delete
+ * @brief adds the values written in the window to the tail and closes the window, so
+ *        the list can be used again. A tail that was opened and got no values is removed.
  */
 template<typename T, int Size>
-void Lariat<T, Size>::deleteNode(LNode* node)
+void Lariat<T, Size>::Appender::flush()
 {
-    if(node == head_)
+    if(cursor_ == nullptr)
     {
-        // return if there is nothing to delete
-        if(head_ == nullptr)
-        {
-            return;
-        }
-
-        // if only the head exists
-        if(head_->next == nullptr)
-        {
-            // delete it and reset head and tail
-            delete head_;
+        return;
+    }
 
-            head_ = nullptr;
-            tail_ = nullptr;
-        }
-        else
-        {
-            // otherwise, delete the head and set the head to its next
-            LNode* temp = head_->next;
+    LNode* tail = list_.tail_;
 
-            delete head_;
+    cursor_ = nullptr;
+    room_ = 0;
 
-            head_ = temp;
+    if(pending_ == 0)
+    {
+        if(tail->count == 0)
+        {
+            list_.deleteNode(tail);
         }
+
+        return;
     }
-    else if(node == tail_)
-    {
-        LNode* temp = tail_->prev;
 
-        // set the node before the tail to its proper value
-        temp->next = nullptr;
-        tail_->next = nullptr;
+    tail->count += pending_;
+    list_.size_ += pending_;
+    pending_ = 0;
 
-        delete tail_;
+    // one index update for every value written in the node
+    list_.index_update(tail);
+}
 
-        // set the tail to what its previous was
-        tail_ = temp;
+/**
+ * @brief opens a window on the free slots after the last value of the tail. A full
+ *        tail gets a new empty node after it, so the appended nodes end up completely full.
+ */
+template<typename T, int Size>
+void Lariat<T, Size>::Appender::open_window()
+{
+    LNode* tail = list_.tail_;
+
+    if(tail == nullptr || tail->count == list_.asize_)
+    {
+        tail = list_.append_node();
     }
-    else
+    else if(tail->begin + tail->count == list_.asize_)
     {
-        // update the prev/next values of the node before and after
-        node->prev->next = node->next;
-        node->next->prev = node->prev;
-
-        // delete the node
-        delete node;
+        // the free slots are all at the front
+        list_.rebase(tail, 0);
     }
 
-    // a node was removed
-    nodecount_--;
+    cursor_ = tail->data() + tail->count;
+    room_ = list_.asize_ - tail->begin - tail->count;
 }
 
 #else // fancier 
 #endif
+
+// only the definitions above count, don't leave the macro to the files that include lariat.h
+#undef LARIAT_COUNT
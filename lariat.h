@@ -18,6 +18,19 @@
 #include <string>     // error strings
 #include <utility>    // error strings
 #include <cstring>     // memcpy
+#include <algorithm>   // block moves
+#include <cstddef>     // ptrdiff_t
+#include <iterator>    // iterator tags, reverse_iterator
+#include <type_traits> // iterator const conversion
+#include <atomic>      // slab node counts
+#include <new>         // aligned slab allocation
+#include <exception>   // exception base
+#include <cstdint>     // snapshot header fields
+#include <iosfwd>      // snapshot streams
+#include <functional>  // default sorted order
+#include <initializer_list> // list construction
+
+#include "lariat_simd.h" // vectorized find
 
 class LariatException : public std::exception {
   private:  
@@ -42,13 +55,112 @@ class LariatException : public std::exception {
     enum LARIAT_EXCEPTION {E_NO_MEMORY, E_BAD_INDEX, E_DATA_ERROR};
 };
 
-// forward declaration for 1-1 operator<< 
-template<typename T, int Size> 
+// header of the binary snapshot Lariat::save writes, the values follow it packed at dataOffset
+struct LariatSnapshotHeader
+{
+    static constexpr char     MAGIC[9] = "LARIATSS";
+    static constexpr uint32_t FORMAT_VERSION = 1;
+    static constexpr uint32_t ENDIAN_CHECK = 0x01020304; // written in the byte order of the machine
+    static constexpr uint64_t DATA_ALIGNMENT = 64;     // the values start on a multiple of this
+
+    char     magic[8];    // MAGIC without the terminator
+    uint32_t version;     // FORMAT_VERSION
+    uint32_t byteOrder;   // ENDIAN_CHECK
+    uint32_t valueSize;   // sizeof the value type
+    uint32_t nodeSize;    // Size of the lariat that wrote it, a reader can use any Size
+    uint64_t count;       // the number of values
+    uint64_t dataOffset;  // where the values start, from the start of the header
+
+    // throws if the header isn't one this code wrote for a value type of this size
+    void check(uint32_t expectedValueSize) const {
+      if(std::memcmp(magic, MAGIC, sizeof(magic)) != 0)
+        throw LariatException(LariatException::E_DATA_ERROR, "Not a lariat snapshot");
+
+      if(version != FORMAT_VERSION || byteOrder != ENDIAN_CHECK)
+        throw LariatException(LariatException::E_DATA_ERROR, "Snapshot version or byte order not supported");
+
+      if(valueSize != expectedValueSize || count > static_cast<uint64_t>(INT32_MAX) || dataOffset < sizeof(LariatSnapshotHeader))
+        throw LariatException(LariatException::E_DATA_ERROR, "Snapshot doesn't match the value type");
+    }
+};
+
+// how a full node makes room when a value is pushed on the end of the list
+enum LariatSplitPolicy {
+    SPLIT_BALANCED, // split the full node in half (default)
+    SPLIT_APPEND,   // push_back on a full tail opens a new empty tail, nothing moves
+    SPLIT_PREPEND   // push_front on a full head opens a new empty head, nothing moves
+};
+
+// what Lariat::dump writes
+enum LariatDumpFormat {
+    DUMP_VALUES, // one value per line
+    DUMP_NODES   // every node with its count and the index of each value, what operator<< writes
+};
+
+// define LARIAT_STATS to count what the lists do, it changes the layout so define it the same in every file
+// LARIAT_COUNT is undefined again at the end of lariat.cpp
+#ifdef LARIAT_STATS
+#define LARIAT_COUNT(counter, amount) (counters_.counter.fetch_add(static_cast<uint64_t>(amount), std::memory_order_relaxed))
+#else
+#define LARIAT_COUNT(counter, amount) ((void)0)
+#endif
+
+// what Lariat::stats reports, the counters stay 0 unless LARIAT_STATS is defined
+struct LariatStats
+{
+    static constexpr int FILL_BUCKETS = 10;
+
+    size_t   size;          // the number of items
+    int      nodeCount;     // nodes in the list
+    int      nodeCapacity;  // items a node holds
+    int      pooledNodes;   // nodes kept for reuse
+    double   loadFactor;    // size / (nodeCount * nodeCapacity)
+    size_t   bytesUsed;     // the list object, its nodes and its pool
+    size_t   fillHistogram[FILL_BUCKETS]; // nodes by fill, bucket i is i/10 up to (i+1)/10 full, full nodes are in the last
+
+    // counted since the list was made, a copy starts over
+    uint64_t splits;          // full nodes split in two
+    uint64_t nodeAllocations; // nodes taken from the pool
+    uint64_t nodeFrees;       // nodes given back to the pool
+    uint64_t findHops;        // nodes stepped through to find an index
+    uint64_t shiftMoves;      // values moved to open or close a slot in a node
+    uint64_t compactMoves;    // values moved by compact, compact_step and merges
+};
+
+// the Size that makes the node capacity a constructor argument instead of a template argument
+constexpr int LARIAT_DYNAMIC_SIZE = 0;
+
+// node layout, the node header takes one cache line and nodes that fill a page are page aligned
+constexpr size_t LARIAT_CACHE_LINE = 64;
+constexpr size_t LARIAT_PAGE_SIZE = 4096;
+
+// the Size that makes a node fill pageBytes exactly, or as close as the value size allows. Use 2 << 20 for huge pages
+template <typename T>
+constexpr int lariat_page_capacity(size_t pageBytes = LARIAT_PAGE_SIZE)
+{
+    return pageBytes >= LARIAT_CACHE_LINE + sizeof(T) ? static_cast<int>((pageBytes - LARIAT_CACHE_LINE) / sizeof(T)) : 1;
+}
+
+// forward declaration for 1-1 operator<<, without a Size a node fills a page
+template<typename T, int Size = lariat_page_capacity<T>()> 
 class Lariat;
 
 template<typename T, int Size> 
 std::ostream& operator<< (std::ostream& os, Lariat<T, Size> const & rhs);
 
+// erases every value the predicate is true for in one pass, returns the number erased
+template<typename T, int Size, typename Predicate> 
+size_t erase_if(Lariat<T, Size>& list, Predicate pred);
+
+template<typename T, int Size> 
+class ConcurrentLariat;
+
+template<typename T, int Size> 
+class LariatView;
+
+template<typename T, int Size> 
+class LariatParallel;
+
 template <typename T, int Size>
 class Lariat 
 {
@@ -56,10 +168,148 @@ class Lariat
     template<typename U, int USize>
     friend class Lariat;
 
+    // the concurrent lariat moves its values the same way
+    template<typename U, int USize>
+    friend class ConcurrentLariat;
+
+    // the snapshot view searches its values the same way
+    template<typename U, int USize>
+    friend class LariatView;
+
+    // the parallel scans split the nodes over threads, see lariat_parallel.h
+    template<typename U, int USize>
+    friend class LariatParallel;
+
+    private:
+        struct LNode;
+
     public:
 
+        // random access iterator that walks the values of each node in order
+        template <typename Value>
+        class Iterator
+        {
+            friend class Lariat;
+
+            // allow iterator to convert to a const iterator
+            template <typename OtherValue>
+            friend class Iterator;
+
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type        = T;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = Value*;
+                using reference         = Value&;
+
+                Iterator();
+
+                // converting constructor from iterator to const_iterator
+                template <typename OtherValue, typename = typename std::enable_if<std::is_convertible<OtherValue*, Value*>::value>::type>
+                Iterator(const Iterator<OtherValue>& other);
+
+                reference operator*() const;
+                pointer   operator->() const;
+                reference operator[](difference_type n) const;
+
+                Iterator& operator++();
+                Iterator  operator++(int);
+                Iterator& operator--();
+                Iterator  operator--(int);
+
+                Iterator& operator+=(difference_type n);
+                Iterator& operator-=(difference_type n);
+                Iterator  operator+(difference_type n) const;
+                Iterator  operator-(difference_type n) const;
+
+                template <typename OtherValue>
+                difference_type operator-(const Iterator<OtherValue>& other) const;
+
+                template <typename OtherValue>
+                bool operator==(const Iterator<OtherValue>& other) const;
+                template <typename OtherValue>
+                bool operator!=(const Iterator<OtherValue>& other) const;
+                template <typename OtherValue>
+                bool operator<(const Iterator<OtherValue>& other) const;
+                template <typename OtherValue>
+                bool operator>(const Iterator<OtherValue>& other) const;
+                template <typename OtherValue>
+                bool operator<=(const Iterator<OtherValue>& other) const;
+                template <typename OtherValue>
+                bool operator>=(const Iterator<OtherValue>& other) const;
+
+                friend Iterator operator+(difference_type n, const Iterator& it) { return it + n; }
+
+            private:
+                Iterator(LNode* node, int localIndex);
+
+                // global index of the element the iterator is at
+                difference_type position() const;
+
+                LNode* node_;    // node the iterator is in
+                int localIndex_; // index of the element in the node
+        };
+
+        // streams values onto the back, straight into the free slots of the tail node. Values
+        // join the list a node at a time: when the appender moves to the next node, on flush()
+        // and when it is destroyed. Only the appender can touch the list until it flushed
+        class Appender
+        {
+            public:
+                explicit Appender(Lariat& list);
+                ~Appender(); // flushes
+
+                Appender(const Appender&) = delete;
+                Appender& operator=(const Appender&) = delete;
+
+                // zero-copy writes: the free slots at the back as raw storage, at least one. The
+                // caller constructs values in the first ones and commits how many it constructed
+                T*   window(int& count);
+                void commit(int count);
+
+                // one value at a time, the tail is only checked when a node is full
+                template <typename... Args>
+                void emplace(Args&&... args);
+                void push(const T& value);
+                void push(T&& value);
+
+                // drains iterators or any range, a coroutine generator too
+                template <typename InputIt>
+                void append(InputIt first, InputIt last);
+                template <typename Range>
+                void append(Range&& range);
+
+                void flush(); // adds the values written so far to the list
+
+            private:
+                void open_window();
+
+                Lariat& list_;
+                T* cursor_;   // next free slot, null when no window is open
+                int room_;    // free slots left after the cursor
+                int pending_; // values written in the window that aren't in the list yet
+        };
+
+        using value_type             = T;
+        using size_type              = size_t;
+        using difference_type        = std::ptrdiff_t;
+        using reference              = T&;
+        using const_reference        = const T&;
+        using iterator               = Iterator<T>;
+        using const_iterator         = Iterator<const T>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
         Lariat();                  // default constructor                        
+        explicit Lariat(int nodeCapacity); // for LARIAT_DYNAMIC_SIZE, every node holds nodeCapacity items
+
+        // construct from values, filling whole nodes
+        template <typename InputIt, typename = typename std::enable_if<
+            std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type>
+        Lariat(InputIt first, InputIt last);
+        Lariat(std::initializer_list<T> values);
         Lariat( Lariat const& rhs); // copy constructor
+        Lariat( Lariat&& rhs) noexcept; // move constructor
         ~Lariat(); // destructor
         
         // copy constructor of different parameters
@@ -69,13 +319,48 @@ class Lariat
         // assignment operator
         Lariat<T, Size>& operator=(const Lariat<T, Size>& other);
 
+        // move assignment operator
+        Lariat<T, Size>& operator=(Lariat<T, Size>&& other) noexcept;
+
+        // replace the contents, filling whole nodes
+        template <typename InputIt, typename = typename std::enable_if<
+            std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type>
+        void assign(InputIt first, InputIt last);
+        void assign(std::initializer_list<T> values);
+
         // inserts
         void insert(int index, const T& value);
+        void insert(int index, T&& value);
         void push_back(const T& value);
+        void push_back(T&& value);
         void push_front(const T& value);
+        void push_front(T&& value);
+
+        // bulk inserts, each node is touched once
+        template <typename InputIt, typename = typename std::enable_if<
+            std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type>
+        void insert(int index, InputIt first, InputIt last);
+        void insert(int index, int count, const T& value);
+
+        // construct values in place
+        template <typename... Args>
+        void emplace(int index, Args&&... args);
+        template <typename... Args>
+        void emplace_back(Args&&... args);
+        template <typename... Args>
+        void emplace_front(Args&&... args);
+        Appender appender(); // streams values onto the back a node at a time
+
+        // moves whole nodes between lists, splitting at most one node. O(log nodes), the other list is left empty
+        void splice(int index, Lariat&& other); // inserts the values of other before the index
+        void append(Lariat&& other);            // adds the values of other at the end
+        Lariat split_at(int index);             // removes the values from the index on and returns them as a new list
 
         // deletes
         void erase(int index);
+        void erase(int first_index, int last_index); // erases [first_index, last_index)
+        template <typename Predicate>
+        size_t erase_if(Predicate pred);             // erases the values pred is true for and packs the nodes, returns the number erased
         void pop_back();
         void pop_front();
 
@@ -89,18 +374,106 @@ class Lariat
 
         unsigned find(const T& value) const;       // returns index, size (one past last) if not found
 
+        // sorted lists, the values must be in the order of comp. O(log n + Size) instead of a scan
+        template <typename Compare = std::less<T>>
+        unsigned lower_bound(const T& value, Compare comp = Compare()) const; // index of the first value not before value, size if none
+        template <typename Compare = std::less<T>>
+        unsigned upper_bound(const T& value, Compare comp = Compare()) const; // index of the first value after value, size if none
+        template <typename Compare = std::less<T>>
+        unsigned insert_sorted(const T& value, Compare comp = Compare());      // inserts after the equal values, returns the index
+        template <typename Compare = std::less<T>>
+        unsigned insert_sorted(T&& value, Compare comp = Compare());
+
+        // iteration
+        iterator               begin();
+        iterator               end();
+        const_iterator         begin() const;
+        const_iterator         end() const;
+        const_iterator         cbegin() const;
+        const_iterator         cend() const;
+        reverse_iterator       rbegin();
+        reverse_iterator       rend();
+        const_reverse_iterator rbegin() const;
+        const_reverse_iterator rend() const;
+
         friend std::ostream& operator<< <T,Size>( std::ostream &os, Lariat<T, Size> const & list );
 
+        void dump(std::ostream& os, LariatDumpFormat format = DUMP_VALUES) const; // formats into a buffer, written in large chunks
+
         size_t size(void) const;   // total number of items (not nodes)
+        int node_capacity() const; // the number of items a node holds
+        double utilization() const; // fraction of the node slots that hold items
+        LariatStats stats() const;  // node counts, fill and memory, and the LARIAT_STATS counters
         void clear(void);          // make it empty
 
         void compact();             // push data in front reusing empty positions and delete remaining nodes
+        bool compact_step(int budget); // compacts a few nodes, resuming where the last step stopped. true when a pass finished
+
+        // merge a node into a neighbor when an erase leaves it with fewer than count items (0 is off)
+        void set_merge_threshold(int count);
+        int merge_threshold() const;
+
+        // how full nodes split when pushing on the ends
+        void set_split_policy(LariatSplitPolicy policy);
+        LariatSplitPolicy split_policy() const;
+
+        // node pool
+        void reserve_nodes(int count); // make sure count nodes can be in the list without allocating
+        void reserve(int count);       // make sure count items fit in full nodes without allocating
+        void shrink_to_fit();          // free every pooled node that isn't in the list
+
+        // binary snapshots, only for trivially copyable types
+        void save(std::ostream& os) const;
+        void save(const std::string& path) const;
+        void load(std::istream& is);           // replaces the contents, the nodes are completely full
+        void load(const std::string& path);
     private:
-        struct LNode { // DO NOT modify provided code
+        // a block of memory that nodes are carved from, freed when all its nodes are released
+        struct NodeSlab
+        {
+            std::atomic<int> nodes; // number of nodes carved from the slab that haven't been released
+            size_t alignment;       // alignment the slab was allocated with
+        };
+
+        // nodes with at least a cache line of values start on a line. The header below is one line on
+        // 64-bit builds, so an index hop reads a single line and the values are aligned for vector loads
+        static constexpr size_t NODE_ALIGNMENT = std::max(Size == LARIAT_DYNAMIC_SIZE || Size * sizeof(T) >= LARIAT_CACHE_LINE ? 
+                                                          LARIAT_CACHE_LINE : alignof(void*), alignof(T));
+
+        // nodes of up to 8 trivially copyable values in a cache line. A move in them is one of a few
+        // constant lengths, inlined to loads and stores instead of a memmove call
+        static constexpr bool TINY_NODES = Size > 0 && Size <= 8 && Size * sizeof(T) <= LARIAT_CACHE_LINE && std::is_trivially_copyable<T>::value;
+
+        // a node holds count values in the slots [begin, begin + count), and is linked both into the
+        // list by next/prev and into the index, where subtreeCount and subtreeNodes always sum its subtree
+        struct alignas(NODE_ALIGNMENT) LNode {
             LNode *next  = nullptr;
             LNode *prev  = nullptr;
             int    count = 0;         // number of items currently in the node
-            T values[ Size ];
+            int    subtreeNodes = 0;  // number of nodes in the index subtree of this node, itself included
+
+            // order-statistic index over the node chain (a treap ordered like the list)
+            LNode *parent = nullptr;
+            LNode *left   = nullptr;
+            LNode *right  = nullptr;
+            int    subtreeCount = 0;  // number of items in this node and all nodes below it in the index
+            int    begin = 0;         // slot of the first value, the slots before it are free
+
+            NodeSlab *slab = nullptr; // slab the node was carved from
+
+            // values are raw storage, only the count from begin on are constructed. With a dynamic
+            // size the array is a flexible member, nodes are allocated with room for asize_ values
+            union
+            {
+                T values[ Size > 0 ? Size : 1 ];
+            };
+
+            LNode() {}
+            ~LNode() {}
+
+            // the first value
+            T* data() { return values + begin; }
+            const T* data() const { return values + begin; }
         };
 
         struct ElementInfo
@@ -109,23 +482,86 @@ class Lariat
             int localIndex;
         };
 
-        // DO NOT modify provided code
         LNode *head_;           // points to the first node
         LNode *tail_;           // points to the last node
         int size_;              // the number of items (not nodes) in the list
         mutable int nodecount_; // the number of nodes in the list
         int asize_;             // the size of the array within the nodes
 
+        LNode *root_;           // root of the order-statistic index over the nodes
+
+        LNode *freeNodes_;      // retired nodes kept for reuse, linked by next
+        int freecount_;         // the number of nodes in the pool
+
+        LariatSplitPolicy splitPolicy_; // how full nodes split when pushing on the ends
+
+        LNode *compactCursor_;  // node compact_step is filling, null to start at the head
+        int mergeThreshold_;    // nodes left with fewer items than this by an erase merge with a neighbor
+
+        LNode *finger_;         // node of the last lookup, null when a change could have moved it
+        int fingerBase_;        // global index of the first element in the finger node
+
+#ifdef LARIAT_STATS
+        // counted with LARIAT_COUNT, atomic so the parallel scans can count too
+        struct Counters
+        {
+            std::atomic<uint64_t> splits{0};
+            std::atomic<uint64_t> nodeAllocations{0};
+            std::atomic<uint64_t> nodeFrees{0};
+            std::atomic<uint64_t> findHops{0};
+            std::atomic<uint64_t> shiftMoves{0};
+            std::atomic<uint64_t> compactMoves{0};
+        };
+
+        mutable Counters counters_;
+#endif
+
     private:
 
-        // Pushes a value when the list is empty
-        void push_first_value(const T& value);
+        // Constructs a value when the list is empty
+        template <typename... Args>
+        void push_first_value(Args&&... args);
+
+        // Constructs a value at the back of a specific node.
+        template <typename... Args>
+        void push_back_in_node(LNode* node, Args&&... args);
 
-        // Pushes back a value in a specific node.
-        void push_back_in_node(LNode* node, const T& value);
+        // Inserts a value in a node that has room.
+        void insert_in_node(LNode* node, int localIndex, T&& value);
+
+        // makes sure the nodes an insert of count values at the index needs are in the pool.
+        void reserve_for_insert(int index, std::ptrdiff_t count);
+
+        // the number of nodes count items fill, without overflowing.
+        int nodes_for(std::ptrdiff_t count) const;
+
+        // Inserts values from a source at the index, filling whole nodes.
+        template <typename Done, typename Construct>
+        void insert_values(int index, Done done, Construct construct);
+
+        // appends a copy of every node of another lariat.
+        void copy_nodes(const Lariat& other);
+
+        // creates an empty node and links it into the list after another node.
+        LNode* insert_node_after(LNode* where);
+
+        // creates an empty node at the end of the list.
+        LNode* append_node();
+
+        // creates an empty node at the front of the list.
+        LNode* prepend_node();
+
+        // moves the values from a local index on into a new node after the node.
+        LNode* split_node_at(LNode* node, int localIndex);
+
+        // returns the first node of the values from the index on, splitting the node the index is in.
+        LNode* node_boundary(int index);
+
+        // leaves the list empty without freeing its nodes, after another list took them.
+        void forget_nodes();
 
         // This insert a value in a full node.
-        void insert_in_full_node(LNode* node, int localIndex, const T& value);
+        void insert_in_full_node(LNode* node, int localIndex, T&& value);
 
         // takes a full node and splits into two nodes of an aproximately equivalent number of elements.
         LNode* split(LNode* node);
@@ -133,14 +569,97 @@ class Lariat
         // takes a global index to find in the list and returns both a pointer to the node in the list and the local index of the element in the returned node.
         ElementInfo find_element(int index);
 
-        // swaps every element between the index and the last element in the node's array in place.
+        // descends the index to the node holding a global index, without touching the finger.
+        ElementInfo index_find(int index) const;
+
+        // descends the index to the first value that before returns false for, the values must be partitioned by before.
+        template <typename Before>
+        unsigned partition_index(Before before) const;
+
+        // returns the index of the first value equal to a value in a block of values, count if none is.
+        static int find_in_values(const T* values, int count, const T& value);
+
+        // moves every element from the index onward up one, leaving an uninitialized gap at the index.
         void shiftUp(LNode* node, int localIndex);
-        // swaps each element from local index onward with the element immediately before it.
+        // moves each element after local index down one into the uninitialized slot at local index.
         void shiftDown(LNode* node, int localIndex);
 
+        // opens an uninitialized gap at the local index of a node with room, moving the smaller side.
+        void open_gap(LNode* node, int localIndex);
+        // closes the uninitialized slot at the local index, moving the smaller side.
+        void close_gap(LNode* node, int localIndex);
+        // moves the values of a node so the first one is in a slot.
+        void rebase(LNode* node, int begin);
+
+        // moves a block of values into uninitialized slots, the ranges can overlap (memmove for trivially copyable types).
+        static void relocate_values(T* destination, T* source, int count);
+        // relocate_values for tiny nodes, one constant length move for each count up to Size.
+        template <int... Counts>
+        static void relocate_tiny(T* destination, T* source, int count, std::integer_sequence<int, Counts...>);
+
         // deletes a node
         void deleteNode(LNode* node);
 
+        // moves every value of the next node into a node and deletes the next node if they fit in one node.
+        bool merge_with_next(LNode* node);
+
+        // deletes every node after a node, they must hold no items.
+        void delete_empty_tail(LNode* last);
+
+        // merges a node that an erase left below the merge threshold with a neighbor.
+        void merge_after_erase(LNode* node);
+
+        // takes a node from the pool, carving a new slab if the pool is empty.
+        LNode* allocate_node();
+
+        // returns a node to the pool.
+        void free_node(LNode* node);
+
+        // carves a new slab of nodes into the pool.
+        void allocate_slab(int nodes);
+
+        // the bytes a node takes, more than sizeof(LNode) with a dynamic size.
+        size_t node_bytes() const;
+
+        // the alignment of new slabs, a page when the nodes fill whole pages.
+        size_t slab_alignment() const;
+
+        // the capacity of a dynamic size node when none is given, about a page of values.
+        static int default_capacity();
+
+        // destroys a node and gives its memory back to its slab.
+        static void release_node(LNode* node);
+
+        // adds a node to the index directly after another node (or at the front if where is null).
+        void index_insert_after(LNode* where, LNode* node);
+
+        // removes a node from the index.
+        void index_erase(LNode* node);
+
+        // recalculates the item counts of a node and every node above it in the index after its count changed.
+        void index_update(LNode* node);
+
+        // recalculates the item counts of every node in the index below and including node.
+        void index_recount(LNode* node);
+
+        // rotates a node above its parent in the index.
+        void index_rotate_up(LNode* node);
+
+        // recalculates the item and node counts of a node from its children in the index.
+        static void index_recalculate(LNode* node);
+
+        // joins two indexes, every node of first is before the nodes of second in the list. Returns the new root.
+        static LNode* index_join(LNode* first, LNode* second);
+
+        // splits an index at a node boundary into the nodes before a global index and the nodes from it on.
+        static void index_split(LNode* node, int index, LNode*& first, LNode*& second);
+
+        // returns the heap priority of a node in the index, a hash of its address.
+        static unsigned index_priority(const LNode* node);
+
+        // returns the global index of the first element in a node.
+        static int index_of(const LNode* node);
+
 };
 
 #include "lariat.cpp"
@@ -0,0 +1,294 @@
+/**
+ * @file lariat_parallel.cpp
+ * @brief Scans of a lariat split over threads. The list is cut into one even range of
+ *        indexes per thread, and each thread finds its start with an index lookup instead
+ *        of walking the chain. Kept out of lariat.h so only the code that uses them pulls
+ *        in <thread> and links the thread library.
+ *
+ * @date 10-15-2026
+ */
+
+/**
+ * @brief finds a value with the list split over threads, see LariatParallel::find
+ *
+ * @param list - list to search
+ * @param value - value to find
+ * @param threads - number of threads to use, 0 for one per core
+ * @return - index of the first matching value, size (one past last) if not found
+ */
+template <typename T, int Size>
+unsigned parallel_find(const Lariat<T, Size>& list, const typename Lariat<T, Size>::value_type& value, unsigned threads)
+{
+    return LariatParallel<T, Size>::find(list, value, threads);
+}
+
+/**
+ * @brief calls a function on every value with the list split over threads. The function
+ *        is called from several threads at once, and on values in no particular order.
+ *
+ * @param list - list to visit
+ * @param function - function taking a T&
+ * @param threads - number of threads to use, 0 for one per core
+ */
+template <typename T, int Size, typename Function>
+void parallel_for_each(Lariat<T, Size>& list, Function function, unsigned threads)
+{
+    LariatParallel<T, Size>::template for_each<T>(list, function, threads);
+}
+
+/**
+ * @brief calls a function on every value with the list split over threads. The function
+ *        is called from several threads at once, and on values in no particular order.
+ *
+ * @param list - list to visit
+ * @param function - function taking a const T&
+ * @param threads - number of threads to use, 0 for one per core
+ */
+template <typename T, int Size, typename Function>
+void parallel_for_each(const Lariat<T, Size>& list, Function function, unsigned threads)
+{
+    LariatParallel<T, Size>::template for_each<const T>(list, function, threads);
+}
+
+/**
+ * @brief counts the values a predicate is true for, with the list split over threads.
+ *        The predicate is called from several threads at once.
+ *
+ * @param list - list to count in
+ * @param predicate - predicate taking a const T&
+ * @param threads - number of threads to use, 0 for one per core
+ * @return - the number of values the predicate is true for
+ */
+template <typename T, int Size, typename Predicate>
+size_t parallel_count_if(const Lariat<T, Size>& list, Predicate predicate, unsigned threads)
+{
+    return LariatParallel<T, Size>::count_if(list, predicate, threads);
+}
+
+/**
+ * @brief finds a value with the list split over threads. Each thread scans an even part
+ *        of the list and stops once another thread found the value earlier in the list.
+ *
+ * @param list - list to search
+ * @param value - value to find
+ * @param threads - number of threads to use, 0 for one per core
+ * @return - index of the first matching value, size (one past last) if not found
+ */
+template <typename T, int Size>
+unsigned LariatParallel<T, Size>::find(const List& list, const T& value, unsigned threads)
+{
+    std::atomic<int> found(list.size_);
+
+    ranges(list, threads, [&](LNode* node, int localIndex, int index, int count)
+    {
+        // give up once a value was found before this part of the list
+        while(count > 0 && index < found.load(std::memory_order_relaxed))
+        {
+            int block = std::min(node->count - localIndex, count);
+            int match = List::find_in_values(node->data() + localIndex, block, value);
+
+            if(match < block)
+            {
+                int current = found.load();
+
+                // keep the lowest index
+                while(index + match < current && !found.compare_exchange_weak(current, index + match))
+                {
+                }
+
+                return;
+            }
+
+            index += block;
+            count -= block;
+
+            node = node->next;
+            localIndex = 0;
+        }
+    });
+
+    return found.load();
+}
+
+/**
+ * @brief calls a function on every value with the list split over threads
+ *
+ * @param list - list to visit
+ * @param function - function taking a Value&
+ * @param threads - number of threads to use, 0 for one per core
+ */
+template <typename T, int Size>
+template <typename Value, typename Function>
+void LariatParallel<T, Size>::for_each(const List& list, Function& function, unsigned threads)
+{
+    ranges(list, threads, [&](LNode* node, int localIndex, int, int count)
+    {
+        for_each_in_range<Value>(node, localIndex, count, function);
+    });
+}
+
+/**
+ * @brief counts the values a predicate is true for with the list split over threads, each
+ *        thread counts its range on its own and adds it to the total once
+ *
+ * @param list - list to count in
+ * @param predicate - predicate taking a const T&
+ * @param threads - number of threads to use, 0 for one per core
+ * @return - the number of values the predicate is true for
+ */
+template <typename T, int Size>
+template <typename Predicate>
+size_t LariatParallel<T, Size>::count_if(const List& list, Predicate& predicate, unsigned threads)
+{
+    std::atomic<size_t> total(0);
+
+    ranges(list, threads, [&](LNode* node, int localIndex, int, int count)
+    {
+        size_t matches = 0;
+
+        auto counter = [&](const T& value)
+        {
+            if(predicate(value))
+            {
+                ++matches;
+            }
+        };
+
+        for_each_in_range<const T>(node, localIndex, count, counter);
+
+        total += matches;
+    });
+
+    return total.load();
+}
+
+/**
+ * @brief splits the list into one even range of indexes per thread and runs work on each
+ *        range, the first on the calling thread. Each range starts with an index lookup, so
+ *        the threads don't walk the list to their start. Small lists use fewer threads.
+ *        An exception thrown by work is rethrown once every thread finished.
+ *
+ * @param list - list to split
+ * @param threads - number of threads to use, 0 for one per core
+ * @param work - called with the first node, the local index in it, the global index and the number of values of a range
+ */
+template <typename T, int Size>
+template <typename Work>
+void LariatParallel<T, Size>::ranges(const List& list, unsigned threads, Work work)
+{
+    // don't start a thread for less than this many values
+    const int minimumPerThread = 1 << 14;
+
+    int size = list.size_;
+
+    if(size == 0)
+    {
+        return;
+    }
+
+    if(threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    threads = std::min(threads, static_cast<unsigned>(std::max(1, size / minimumPerThread)));
+
+    std::vector<std::exception_ptr> errors(threads);
+
+    auto run = [&](unsigned part)
+    {
+        int first = static_cast<int>(static_cast<long long>(size) * part / threads);
+        int last = static_cast<int>(static_cast<long long>(size) * (part + 1) / threads);
+
+        try
+        {
+            typename List::ElementInfo start = list.index_find(first);
+
+            work(start.node, start.localIndex, first, last - first);
+        }
+        catch(...)
+        {
+            errors[part] = std::current_exception();
+        }
+    };
+
+    // declared after what the workers use, so an exception joins them before that is destroyed
+    std::vector<std::thread> workers;
+
+    struct JoinGuard
+    {
+        std::vector<std::thread>& threads;
+
+        ~JoinGuard()
+        {
+            for(std::thread& thread : threads)
+            {
+                if(thread.joinable())
+                {
+                    thread.join();
+                }
+            }
+        }
+    } joinGuard{ workers };
+
+    // no growth once threads are running
+    workers.reserve(threads - 1);
+
+    for(unsigned part = 1; part < threads; ++part)
+    {
+        try
+        {
+            workers.emplace_back(run, part);
+        }
+        catch(const std::system_error&)
+        {
+            // couldn't start a thread, do the range here
+            run(part);
+        }
+    }
+
+    run(0);
+
+    for(std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    for(std::exception_ptr& error : errors)
+    {
+        if(error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/**
+ * @brief calls a function on every value in a range of values, node by node
+ *
+ * @param node - node the range starts in
+ * @param localIndex - index in the node the range starts at
+ * @param count - number of values in the range
+ * @param function - function to call on each value
+ */
+template <typename T, int Size>
+template <typename Value, typename Function>
+void LariatParallel<T, Size>::for_each_in_range(LNode* node, int localIndex, int count, Function& function)
+{
+    while(count > 0)
+    {
+        int end = std::min(node->count, localIndex + count);
+
+        for(int i = localIndex; i < end; ++i)
+        {
+            Value& value = node->data()[i];
+
+            function(value);
+        }
+
+        count -= end - localIndex;
+
+        node = node->next;
+        localIndex = 0;
+    }
+}
@@ -0,0 +1,60 @@
+/**
+ * @file lariat_parallel.h
+ * @brief Scans of a lariat split over threads. The list is cut into one even range of
+ *        indexes per thread, and each thread finds its start with an index lookup instead
+ *        of walking the chain. Kept out of lariat.h so only the code that uses them pulls
+ *        in <thread> and links the thread library.
+ *
+ * @date 10-15-2026
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef LARIAT_PARALLEL_H
+#define LARIAT_PARALLEL_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>       // found index, match counts
+#include <exception>    // rethrowing worker exceptions
+#include <system_error> // thread start failures
+#include <thread>       // workers
+#include <vector>       // workers and their errors
+
+#include "lariat.h" // index lookups, find
+
+// the scans, the list must not change while they run (0 threads uses every core)
+template <typename T, int Size>
+unsigned parallel_find(const Lariat<T, Size>& list, const typename Lariat<T, Size>::value_type& value, unsigned threads = 0); // returns index, size (one past last) if not found
+template <typename T, int Size, typename Function>
+void parallel_for_each(Lariat<T, Size>& list, Function function, unsigned threads = 0);
+template <typename T, int Size, typename Function>
+void parallel_for_each(const Lariat<T, Size>& list, Function function, unsigned threads = 0);
+template <typename T, int Size, typename Predicate>
+size_t parallel_count_if(const Lariat<T, Size>& list, Predicate predicate, unsigned threads = 0);
+
+// does the scans above with access to the nodes of the list
+template <typename T, int Size>
+class LariatParallel
+{
+    using List = Lariat<T, Size>;
+    using LNode = typename List::LNode;
+
+    public:
+        static unsigned find(const List& list, const T& value, unsigned threads);
+        template <typename Value, typename Function>
+        static void for_each(const List& list, Function& function, unsigned threads); // Value is T only when the caller has the list non-const
+        template <typename Predicate>
+        static size_t count_if(const List& list, Predicate& predicate, unsigned threads);
+
+    private:
+        // splits the list into even ranges and runs work on each range in its own thread.
+        template <typename Work>
+        static void ranges(const List& list, unsigned threads, Work work);
+
+        // calls function on every value in a range.
+        template <typename Value, typename Function>
+        static void for_each_in_range(LNode* node, int localIndex, int count, Function& function);
+};
+
+#include "lariat_parallel.cpp"
+
+#endif // LARIAT_PARALLEL_H
@@ -0,0 +1,232 @@
+/**
+ * @file lariat_queue.cpp
+ * @brief LariatQueue is a first in first out queue of lariat nodes for one producer thread
+ *        and one consumer thread, without locks. The producer appends to the tail node and
+ *        publishes each value with the node's count, the consumer reads from the head node
+ *        at the node's begin offset, so a pop never moves the other values. Nodes the
+ *        consumer finished are reused by the producer.
+ *
+ * @date 10-14-2026
+ */
+
+/**
+ * @brief Construct an empty queue with one node
+ */
+template<typename T, int Size>
+LariatQueue<T, Size>::LariatQueue() : head_(allocate_node())
+{
+    tail_ = head_.load(std::memory_order_relaxed);
+    oldest_ = tail_;
+    headSeen_ = tail_;
+}
+
+/**
+ * @brief Destroy the queue and the values still in it
+ */
+template<typename T, int Size>
+LariatQueue<T, Size>::~LariatQueue()
+{
+    // every node is linked from the oldest finished one, finished nodes hold no values
+    for(QNode* walker = oldest_; walker != nullptr; )
+    {
+        QNode* next = walker->next.load(std::memory_order_relaxed);
+        int count = walker->count.load(std::memory_order_relaxed);
+
+        for(int i = walker->begin; i < count; ++i)
+        {
+            walker->values[i].~T();
+        }
+
+        delete walker;
+
+        walker = next;
+    }
+}
+
+/**
+ * @brief adds a copy of a value at the back, producer only
+ *
+ * @param value - value to push
+ */
+template<typename T, int Size>
+void LariatQueue<T, Size>::push(const T& value)
+{
+    emplace(value);
+}
+
+/**
+ * @brief moves a value to the back, producer only
+ *
+ * @param value - value to push
+ */
+template<typename T, int Size>
+void LariatQueue<T, Size>::push(T&& value)
+{
+    emplace(std::move(value));
+}
+
+/**
+ * @brief constructs a value at the back, producer only. The value is visible to the
+ *        consumer once it is completely constructed.
+ *
+ * @param args - arguments to construct the value with
+ */
+template<typename T, int Size>
+template<typename... Args>
+void LariatQueue<T, Size>::emplace(Args&&... args)
+{
+    int count = tail_->count.load(std::memory_order_relaxed);
+
+    if(count == Size)
+    {
+        append_node();
+
+        count = 0;
+    }
+
+    new (tail_->values + count) T(std::forward<Args>(args)...);
+
+    // publish the value
+    tail_->count.store(count + 1, std::memory_order_release);
+}
+
+/**
+ * @brief moves the oldest value out of the queue, consumer only
+ *
+ * @param value - set to the popped value
+ * @return true - a value was popped
+ * @return false - the queue was empty, value is unchanged
+ */
+template<typename T, int Size>
+bool LariatQueue<T, Size>::try_pop(T& value)
+{
+    QNode* node = readable_node();
+
+    if(node == nullptr)
+    {
+        return false;
+    }
+
+    T& oldest = node->values[node->begin];
+
+    value = std::move(oldest);
+    oldest.~T();
+
+    node->begin++;
+
+    return true;
+}
+
+/**
+ * @brief returns the oldest value without popping it, consumer only
+ *
+ * @return - the oldest value, null if the queue is empty
+ */
+template<typename T, int Size>
+T* LariatQueue<T, Size>::front()
+{
+    QNode* node = readable_node();
+
+    return node != nullptr ? node->values + node->begin : nullptr;
+}
+
+/**
+ * @brief returns whether there is nothing to pop right now, consumer only. The producer
+ *        can push right after.
+ */
+template<typename T, int Size>
+bool LariatQueue<T, Size>::empty()
+{
+    return readable_node() == nullptr;
+}
+
+/**
+ * @brief returns the head node if a value can be popped from it. A head node the consumer
+ *        popped every value of is finished once the producer linked a node after it, then
+ *        the consumer moves on and the producer can reuse it.
+ *
+ * @return - node with a value at its begin offset, null if the queue is empty
+ */
+template<typename T, int Size>
+typename LariatQueue<T, Size>::QNode* LariatQueue<T, Size>::readable_node()
+{
+    QNode* node = head_.load(std::memory_order_relaxed);
+
+    while(true)
+    {
+        if(node->begin < node->count.load(std::memory_order_acquire))
+        {
+            return node;
+        }
+
+        // the producer is still filling this node
+        if(node->begin < Size)
+        {
+            return nullptr;
+        }
+
+        QNode* next = node->next.load(std::memory_order_acquire);
+
+        if(next == nullptr)
+        {
+            return nullptr;
+        }
+
+        // hand the node back, the producer can reuse it from now on
+        head_.store(next, std::memory_order_release);
+
+        node = next;
+    }
+}
+
+/**
+ * @brief starts a new tail after the full one. Reuses the oldest finished node, and only
+ *        allocates when every node up to the consumer's head is still in use.
+ */
+template<typename T, int Size>
+void LariatQueue<T, Size>::append_node()
+{
+    // look at the consumer again only when the nodes seen as finished are used up
+    if(oldest_ == headSeen_)
+    {
+        headSeen_ = head_.load(std::memory_order_acquire);
+    }
+
+    QNode* node;
+
+    if(oldest_ != headSeen_)
+    {
+        node = oldest_;
+        oldest_ = oldest_->next.load(std::memory_order_relaxed);
+
+        node->next.store(nullptr, std::memory_order_relaxed);
+        node->count.store(0, std::memory_order_relaxed);
+        node->begin = 0;
+    }
+    else
+    {
+        node = allocate_node();
+    }
+
+    // the consumer sees the reset node through next
+    tail_->next.store(node, std::memory_order_release);
+    tail_ = node;
+}
+
+/**
+ * @brief allocates an empty node
+ *
+ * @return - the new node
+ */
+template<typename T, int Size>
+typename LariatQueue<T, Size>::QNode* LariatQueue<T, Size>::allocate_node()
+{
+    try
+    {
+        return new QNode;
+    }
+    catch(const std::bad_alloc& e)
+    {
+        throw LariatException(LariatException::E_NO_MEMORY, e.what());
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file lariat_queue.h
+ * @brief LariatQueue is a first in first out queue of lariat nodes for one producer thread
+ *        and one consumer thread, without locks. The producer appends to the tail node and
+ *        publishes each value with the node's count, the consumer reads from the head node
+ *        at the node's begin offset, so a pop never moves the other values. Nodes the
+ *        consumer finished are reused by the producer.
+ *
+ * @date 10-14-2026
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef LARIAT_QUEUE_H
+#define LARIAT_QUEUE_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic> // node publication
+
+#include "lariat.h" // LariatException, cache line size
+
+/*
+ * Threads:
+ *  - push and emplace are only called by the producer, try_pop, front and empty only by
+ *    the consumer. Both can run at the same time.
+ *  - the producer owns tail_ and the count of the tail node. A value is constructed before
+ *    the count that covers it is stored, so the consumer never sees it half made.
+ *  - the consumer owns head_ and the begin offset of the head node. It moves to the next
+ *    node once it popped all Size values of a node the producer has moved past.
+ *  - the nodes before head_ are finished. The producer reuses them from the oldest on,
+ *    and only allocates when it caught up with the consumer.
+ */
+template <typename T, int Size>
+class LariatQueue
+{
+    static_assert(Size > 0, "needs a fixed Size");
+
+    public:
+        using value_type = T;
+
+        LariatQueue();  // default constructor
+        ~LariatQueue(); // destructor, neither thread can be using it
+
+        LariatQueue(const LariatQueue&) = delete;
+        LariatQueue& operator=(const LariatQueue&) = delete;
+
+        // producer
+        void push(const T& value);
+        void push(T&& value);
+        template <typename... Args>
+        void emplace(Args&&... args);
+
+        // consumer
+        bool try_pop(T& value); // moves the oldest value out, false if the queue is empty
+        T*   front();           // the oldest value, null if the queue is empty
+        bool empty();           // true if nothing can be popped right now
+
+    private:
+        struct QNode
+        {
+            std::atomic<QNode*> next{nullptr}; // set by the producer when it moves on
+            std::atomic<int>    count{0};      // values the producer published
+            int                 begin = 0;     // first value the consumer hasn't popped
+
+            // values are raw storage, the ones from begin to count are constructed
+            union
+            {
+                T values[ Size ];
+            };
+
+            QNode() {}
+            ~QNode() {}
+        };
+
+        // the consumer's side, on its own cache line
+        alignas(LARIAT_CACHE_LINE) std::atomic<QNode*> head_; // node being popped from
+
+        // the producer's side
+        alignas(LARIAT_CACHE_LINE) QNode* tail_; // node being pushed to
+        QNode* oldest_;                          // oldest finished node, first to reuse
+        QNode* headSeen_;                        // head_ when the producer last looked
+
+    private:
+
+        // returns the head node if it has a value to pop, moving past finished nodes.
+        QNode* readable_node();
+
+        // links an empty node after the full tail and makes it the tail.
+        void append_node();
+
+        // allocates an empty node.
+        static QNode* allocate_node();
+};
+
+#include "lariat_queue.cpp"
+
+#endif // LARIAT_QUEUE_H
@@ -0,0 +1,394 @@
+/**
+ * @file lariat_simd.h
+ * @brief Vectorized scans over the values of a node. Lariat::find uses these for
+ *        arithmetic types so a node is compared a few cache lines at a time instead
+ *        of one value at a time. On x86-64 the best kernel the CPU supports
+ *        (AVX-512, AVX2 or scalar) is picked once at runtime, on AArch64 NEON is
+ *        always used. Define LARIAT_NO_SIMD to always use the scalar loop.
+ *
+ * @date 10-14-2026
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef LARIAT_SIMD_H
+#define LARIAT_SIMD_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>     // fixed width lanes
+#include <cstring>     // memcpy
+#include <type_traits> // supported types
+
+#if !defined(LARIAT_NO_SIMD) && (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define LARIAT_SIMD_X86 1
+    #include <immintrin.h>
+#elif !defined(LARIAT_NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+    #define LARIAT_SIMD_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace lariat_simd
+{
+    // types with a vector compare: integers of 1, 2, 4 or 8 bytes, float and double
+    template <typename T>
+    struct is_supported : std::integral_constant<bool,
+        (std::is_integral<T>::value && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) ||
+        std::is_same<T, float>::value || std::is_same<T, double>::value> {};
+
+    // the number of values a node needs before a vector scan is worth the call
+    const int min_count = 16;
+
+    // a function that finds a value in a block of values
+    template <typename T>
+    using find_kernel = int (*)(const T* values, int count, T value);
+
+    /**
+     * @brief finds the first value equal to value with a plain loop
+     *
+     * @param values - values to search
+     * @param count - number of values
+     * @param value - value to find
+     * @return local index of the value, count if it isn't there
+     */
+    template <typename T>
+    int find_scalar(const T* values, int count, T value)
+    {
+        for(int i = 0; i < count; ++i)
+        {
+            if(values[i] == value)
+            {
+                return i;
+            }
+        }
+
+        return count;
+    }
+
+#if defined(LARIAT_SIMD_X86)
+
+    /**
+     * @brief compares 32 bytes of values with the key, one mask bit per byte
+     */
+    template <typename T>
+    __attribute__((target("avx2"))) inline unsigned compare_avx2(const T* values, __m256i key)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+        __m256i equal;
+
+        if constexpr(std::is_same<T, float>::value)
+        {
+            equal = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(block), _mm256_castsi256_ps(key), _CMP_EQ_OQ));
+        }
+        else if constexpr(std::is_same<T, double>::value)
+        {
+            equal = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(block), _mm256_castsi256_pd(key), _CMP_EQ_OQ));
+        }
+        else if constexpr(sizeof(T) == 1)
+        {
+            equal = _mm256_cmpeq_epi8(block, key);
+        }
+        else if constexpr(sizeof(T) == 2)
+        {
+            equal = _mm256_cmpeq_epi16(block, key);
+        }
+        else if constexpr(sizeof(T) == 4)
+        {
+            equal = _mm256_cmpeq_epi32(block, key);
+        }
+        else
+        {
+            equal = _mm256_cmpeq_epi64(block, key);
+        }
+
+        return static_cast<unsigned>(_mm256_movemask_epi8(equal));
+    }
+
+    /**
+     * @brief finds the first value equal to value, 128 bytes (two cache lines) per iteration
+     *
+     * @param values - values to search
+     * @param count - number of values
+     * @param value - value to find
+     * @return local index of the value, count if it isn't there
+     */
+    template <typename T>
+    __attribute__((target("avx2"))) int find_avx2(const T* values, int count, T value)
+    {
+        const int bytes = sizeof(T);      // mask bits per value
+        const int lanes = 32 / bytes;     // values per vector
+
+        __m256i key;
+
+        // broadcast the bit pattern of the value to every lane
+        if constexpr(sizeof(T) == 1)
+        {
+            std::int8_t bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            key = _mm256_set1_epi8(bits);
+        }
+        else if constexpr(sizeof(T) == 2)
+        {
+            std::int16_t bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            key = _mm256_set1_epi16(bits);
+        }
+        else if constexpr(sizeof(T) == 4)
+        {
+            std::int32_t bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            key = _mm256_set1_epi32(bits);
+        }
+        else
+        {
+            long long bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            key = _mm256_set1_epi64x(bits);
+        }
+
+        int i = 0;
+
+        // four vectors at a time, only look for the lane once something matched
+        for(; i + 4 * lanes <= count; i += 4 * lanes)
+        {
+            unsigned m0 = compare_avx2(values + i, key);
+            unsigned m1 = compare_avx2(values + i + lanes, key);
+            unsigned m2 = compare_avx2(values + i + 2 * lanes, key);
+            unsigned m3 = compare_avx2(values + i + 3 * lanes, key);
+
+            if((m0 | m1 | m2 | m3) != 0)
+            {
+                if(m0 != 0) return i + __builtin_ctz(m0) / bytes;
+                if(m1 != 0) return i + lanes + __builtin_ctz(m1) / bytes;
+                if(m2 != 0) return i + 2 * lanes + __builtin_ctz(m2) / bytes;
+                return i + 3 * lanes + __builtin_ctz(m3) / bytes;
+            }
+        }
+
+        for(; i + lanes <= count; i += lanes)
+        {
+            unsigned mask = compare_avx2(values + i, key);
+
+            if(mask != 0)
+            {
+                return i + __builtin_ctz(mask) / bytes;
+            }
+        }
+
+        // the values that don't fill a vector
+        return i + find_scalar(values + i, count - i, value);
+    }
+
+    /**
+     * @brief compares 64 bytes of values with the key, one mask bit per value
+     */
+    template <typename T>
+    __attribute__((target("avx512f,avx512bw"))) inline unsigned long long compare_avx512(const T* values, const T& value)
+    {
+        if constexpr(std::is_same<T, float>::value)
+        {
+            return _mm512_cmp_ps_mask(_mm512_loadu_ps(values), _mm512_set1_ps(value), _CMP_EQ_OQ);
+        }
+        else if constexpr(std::is_same<T, double>::value)
+        {
+            return _mm512_cmp_pd_mask(_mm512_loadu_pd(values), _mm512_set1_pd(value), _CMP_EQ_OQ);
+        }
+        else
+        {
+            __m512i block = _mm512_loadu_si512(values);
+
+            if constexpr(sizeof(T) == 1)
+            {
+                std::int8_t bits;
+                std::memcpy(&bits, &value, sizeof(T));
+                return _mm512_cmpeq_epi8_mask(block, _mm512_set1_epi8(bits));
+            }
+            else if constexpr(sizeof(T) == 2)
+            {
+                std::int16_t bits;
+                std::memcpy(&bits, &value, sizeof(T));
+                return _mm512_cmpeq_epi16_mask(block, _mm512_set1_epi16(bits));
+            }
+            else if constexpr(sizeof(T) == 4)
+            {
+                std::int32_t bits;
+                std::memcpy(&bits, &value, sizeof(T));
+                return _mm512_cmpeq_epi32_mask(block, _mm512_set1_epi32(bits));
+            }
+            else
+            {
+                long long bits;
+                std::memcpy(&bits, &value, sizeof(T));
+                return _mm512_cmpeq_epi64_mask(block, _mm512_set1_epi64(bits));
+            }
+        }
+    }
+
+    /**
+     * @brief finds the first value equal to value, 128 bytes (two cache lines) per iteration
+     *
+     * @param values - values to search
+     * @param count - number of values
+     * @param value - value to find
+     * @return local index of the value, count if it isn't there
+     */
+    template <typename T>
+    __attribute__((target("avx512f,avx512bw"))) int find_avx512(const T* values, int count, T value)
+    {
+        const int lanes = 64 / static_cast<int>(sizeof(T)); // values per vector
+
+        int i = 0;
+
+        for(; i + 2 * lanes <= count; i += 2 * lanes)
+        {
+            unsigned long long m0 = compare_avx512(values + i, value);
+            unsigned long long m1 = compare_avx512(values + i + lanes, value);
+
+            if((m0 | m1) != 0)
+            {
+                if(m0 != 0) return i + __builtin_ctzll(m0);
+                return i + lanes + __builtin_ctzll(m1);
+            }
+        }
+
+        for(; i + lanes <= count; i += lanes)
+        {
+            unsigned long long mask = compare_avx512(values + i, value);
+
+            if(mask != 0)
+            {
+                return i + __builtin_ctzll(mask);
+            }
+        }
+
+        // the values that don't fill a vector
+        return i + find_scalar(values + i, count - i, value);
+    }
+
+    /**
+     * @brief picks the best kernel the CPU supports
+     */
+    template <typename T>
+    find_kernel<T> select_find()
+    {
+        __builtin_cpu_init();
+
+        if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+        {
+            return &find_avx512<T>;
+        }
+
+        if(__builtin_cpu_supports("avx2"))
+        {
+            return &find_avx2<T>;
+        }
+
+        return &find_scalar<T>;
+    }
+
+#elif defined(LARIAT_SIMD_NEON)
+
+    /**
+     * @brief finds the first value equal to value, 64 bytes (one cache line) per iteration
+     *
+     * @param values - values to search
+     * @param count - number of values
+     * @param value - value to find
+     * @return local index of the value, count if it isn't there
+     */
+    template <typename T>
+    int find_neon(const T* values, int count, T value)
+    {
+        const int lanes = 16 / static_cast<int>(sizeof(T)); // values per vector
+
+        int i = 0;
+
+        for(; i + 4 * lanes <= count; i += 4 * lanes)
+        {
+            uint8x16_t any;
+
+            if constexpr(std::is_same<T, float>::value)
+            {
+                float32x4_t key = vdupq_n_f32(value);
+                uint32x4_t equal = vorrq_u32(vorrq_u32(vceqq_f32(vld1q_f32(values + i), key), vceqq_f32(vld1q_f32(values + i + lanes), key)),
+                                             vorrq_u32(vceqq_f32(vld1q_f32(values + i + 2 * lanes), key), vceqq_f32(vld1q_f32(values + i + 3 * lanes), key)));
+                any = vreinterpretq_u8_u32(equal);
+            }
+            else if constexpr(std::is_same<T, double>::value)
+            {
+                float64x2_t key = vdupq_n_f64(value);
+                uint64x2_t equal = vorrq_u64(vorrq_u64(vceqq_f64(vld1q_f64(values + i), key), vceqq_f64(vld1q_f64(values + i + lanes), key)),
+                                             vorrq_u64(vceqq_f64(vld1q_f64(values + i + 2 * lanes), key), vceqq_f64(vld1q_f64(values + i + 3 * lanes), key)));
+                any = vreinterpretq_u8_u64(equal);
+            }
+            else
+            {
+                // integers compare their bytes, every byte of a lane has to match so compare lanes of the right width
+                const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(values + i);
+
+                if constexpr(sizeof(T) == 1)
+                {
+                    uint8x16_t key = vdupq_n_u8(static_cast<std::uint8_t>(value));
+                    any = vorrq_u8(vorrq_u8(vceqq_u8(vld1q_u8(bytes), key), vceqq_u8(vld1q_u8(bytes + 16), key)),
+                                   vorrq_u8(vceqq_u8(vld1q_u8(bytes + 32), key), vceqq_u8(vld1q_u8(bytes + 48), key)));
+                }
+                else if constexpr(sizeof(T) == 2)
+                {
+                    uint16x8_t key = vdupq_n_u16(static_cast<std::uint16_t>(value));
+                    const std::uint16_t* lanes16 = reinterpret_cast<const std::uint16_t*>(bytes);
+                    any = vreinterpretq_u8_u16(vorrq_u16(vorrq_u16(vceqq_u16(vld1q_u16(lanes16), key), vceqq_u16(vld1q_u16(lanes16 + 8), key)),
+                                                         vorrq_u16(vceqq_u16(vld1q_u16(lanes16 + 16), key), vceqq_u16(vld1q_u16(lanes16 + 24), key))));
+                }
+                else if constexpr(sizeof(T) == 4)
+                {
+                    uint32x4_t key = vdupq_n_u32(static_cast<std::uint32_t>(value));
+                    const std::uint32_t* lanes32 = reinterpret_cast<const std::uint32_t*>(bytes);
+                    any = vreinterpretq_u8_u32(vorrq_u32(vorrq_u32(vceqq_u32(vld1q_u32(lanes32), key), vceqq_u32(vld1q_u32(lanes32 + 4), key)),
+                                                         vorrq_u32(vceqq_u32(vld1q_u32(lanes32 + 8), key), vceqq_u32(vld1q_u32(lanes32 + 12), key))));
+                }
+                else
+                {
+                    uint64x2_t key = vdupq_n_u64(static_cast<std::uint64_t>(value));
+                    const std::uint64_t* lanes64 = reinterpret_cast<const std::uint64_t*>(bytes);
+                    any = vreinterpretq_u8_u64(vorrq_u64(vorrq_u64(vceqq_u64(vld1q_u64(lanes64), key), vceqq_u64(vld1q_u64(lanes64 + 2), key)),
+                                                         vorrq_u64(vceqq_u64(vld1q_u64(lanes64 + 4), key), vceqq_u64(vld1q_u64(lanes64 + 6), key))));
+                }
+            }
+
+            // something in this cache line matched, find which value
+            if(vmaxvq_u8(any) != 0)
+            {
+                return i + find_scalar(values + i, 4 * lanes, value);
+            }
+        }
+
+        // the values that don't fill a cache line
+        return i + find_scalar(values + i, count - i, value);
+    }
+
+#endif
+
+    /**
+     * @brief finds the first value equal to value in a block of values with the best
+     *        kernel for the type and CPU
+     *
+     * @param values - values to search
+     * @param count - number of values
+     * @param value - value to find
+     * @return local index of the value, count if it isn't there
+     */
+    template <typename T>
+    int find(const T* values, int count, T value)
+    {
+#if defined(LARIAT_SIMD_X86)
+        // the kernel is picked the first time the type is searched
+        static const find_kernel<T> kernel = select_find<T>();
+
+        return kernel(values, count, value);
+#elif defined(LARIAT_SIMD_NEON)
+        return find_neon(values, count, value);
+#else
+        return find_scalar(values, count, value);
+#endif
+    }
+}
+
+#endif // LARIAT_SIMD_H
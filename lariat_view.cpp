@@ -0,0 +1,282 @@
+/**
+ * @file lariat_view.cpp
+ * @brief LariatView is a read-only lariat over a snapshot file written by Lariat::save.
+ *        The file is memory mapped instead of loaded, so opening it costs the same for
+ *        any size, and processes viewing the same snapshot share its pages. The snapshot
+ *        stores the values packed, without the node table, so a view opens a snapshot
+ *        saved by a lariat of any node size, like Lariat::load does. POSIX only.
+ *
+ * @date 10-14-2026
+ */
+
+#include <sys/mman.h> // mmap
+#include <sys/stat.h> // file size
+#include <fcntl.h>    // open
+#include <unistd.h>   // close
+
+/**
+ * @brief Construct an empty view
+ */
+template<typename T, int Block>
+LariatView<T, Block>::LariatView() : mapping_(nullptr), mappingSize_(0), values_(nullptr), size_(0)
+{
+
+}
+
+/**
+ * @brief Construct a view over a snapshot file
+ *
+ * @param path - snapshot written by Lariat::save
+ */
+template<typename T, int Block>
+LariatView<T, Block>::LariatView(const std::string& path) : mapping_(nullptr), mappingSize_(0), values_(nullptr), size_(0)
+{
+    open(path);
+}
+
+/**
+ * @brief Move constructor, takes the mapping of the other view and leaves it empty
+ *
+ * @param rhs - view to move from
+ */
+template<typename T, int Block>
+LariatView<T, Block>::LariatView(LariatView&& rhs) noexcept : mapping_(rhs.mapping_), mappingSize_(rhs.mappingSize_), values_(rhs.values_), size_(rhs.size_)
+{
+    rhs.mapping_ = nullptr;
+    rhs.mappingSize_ = 0;
+    rhs.values_ = nullptr;
+    rhs.size_ = 0;
+}
+
+/**
+ * @brief Destroy the view, unmapping the file
+ */
+template<typename T, int Block>
+LariatView<T, Block>::~LariatView()
+{
+    close();
+}
+
+/**
+ * @brief Move assignment operator, unmaps the current file and takes the mapping of the other view
+ *
+ * @param rhs - view to move from
+ */
+template<typename T, int Block>
+LariatView<T, Block>& LariatView<T, Block>::operator=(LariatView&& rhs) noexcept
+{
+    if(this == &rhs)
+    {
+        return *this;
+    }
+
+    close();
+
+    mapping_ = rhs.mapping_;
+    mappingSize_ = rhs.mappingSize_;
+    values_ = rhs.values_;
+    size_ = rhs.size_;
+
+    rhs.mapping_ = nullptr;
+    rhs.mappingSize_ = 0;
+    rhs.values_ = nullptr;
+    rhs.size_ = 0;
+
+    return *this;
+}
+
+/**
+ * @brief maps a snapshot file read-only, checks its header and points the view at its
+ *        values. Nothing is read up front, the pages are read when they are first used.
+ *        If the file can't be viewed the view is left empty.
+ *
+ * @param path - snapshot written by Lariat::save
+ */
+template<typename T, int Block>
+void LariatView<T, Block>::open(const std::string& path)
+{
+    close();
+
+    int file = ::open(path.c_str(), O_RDONLY);
+
+    if(file < 0)
+    {
+        throw LariatException(LariatException::E_DATA_ERROR, "Could not open " + path);
+    }
+
+    struct stat info;
+
+    if(::fstat(file, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(LariatSnapshotHeader))
+    {
+        ::close(file);
+
+        throw LariatException(LariatException::E_DATA_ERROR, "Snapshot is truncated");
+    }
+
+    size_t length = static_cast<size_t>(info.st_size);
+    void* mapping = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, file, 0);
+
+    // the mapping keeps the file alive
+    ::close(file);
+
+    if(mapping == MAP_FAILED)
+    {
+        throw LariatException(LariatException::E_NO_MEMORY, "Could not map " + path);
+    }
+
+    const LariatSnapshotHeader* header = static_cast<const LariatSnapshotHeader*>(mapping);
+
+    try
+    {
+        header->check(sizeof(T));
+
+        if(header->dataOffset % alignof(T) != 0 || header->dataOffset > length || header->count * sizeof(T) > length - header->dataOffset)
+        {
+            throw LariatException(LariatException::E_DATA_ERROR, "Snapshot is truncated");
+        }
+    }
+    catch(...)
+    {
+        ::munmap(mapping, length);
+
+        throw;
+    }
+
+    mapping_ = mapping;
+    mappingSize_ = length;
+    values_ = reinterpret_cast<const T*>(static_cast<const char*>(mapping) + header->dataOffset);
+    size_ = static_cast<int>(header->count);
+}
+
+/**
+ * @brief unmaps the file, leaving an empty view
+ */
+template<typename T, int Block>
+void LariatView<T, Block>::close()
+{
+    if(mapping_ != nullptr)
+    {
+        ::munmap(mapping_, mappingSize_);
+    }
+
+    mapping_ = nullptr;
+    mappingSize_ = 0;
+    values_ = nullptr;
+    size_ = 0;
+}
+
+/**
+ * @brief returns the value at an index
+ *
+ * @param index - index of the value
+ */
+template<typename T, int Block>
+const T& LariatView<T, Block>::operator[](int index) const
+{
+    return values_[index];
+}
+
+/**
+ * @brief returns the first value
+ */
+template<typename T, int Block>
+const T& LariatView<T, Block>::first() const
+{
+    return values_[0];
+}
+
+/**
+ * @brief returns the last value
+ */
+template<typename T, int Block>
+const T& LariatView<T, Block>::last() const
+{
+    return values_[size_ - 1];
+}
+
+/**
+ * @brief returns the index of the first value equal to a value, scanning Block values
+ *        at a time like Lariat::find scans a node
+ *
+ * @param value - value to find
+ * @return - index of the value, size (one past last) if not found
+ */
+template<typename T, int Block>
+unsigned LariatView<T, Block>::find(const T& value) const
+{
+    for(int index = 0; index < size_; index += Block)
+    {
+        int block = std::min(Block, size_ - index);
+        int localIndex = Lariat<T, Block>::find_in_values(values_ + index, block, value);
+
+        if(localIndex < block)
+        {
+            return index + localIndex;
+        }
+    }
+
+    return size_;
+}
+
+/**
+ * @brief returns an iterator to the first value
+ */
+template<typename T, int Block>
+typename LariatView<T, Block>::const_iterator LariatView<T, Block>::begin() const
+{
+    return values_;
+}
+
+/**
+ * @brief returns an iterator one past the last value
+ */
+template<typename T, int Block>
+typename LariatView<T, Block>::const_iterator LariatView<T, Block>::end() const
+{
+    return values_ + size_;
+}
+
+/**
+ * @brief returns an iterator to the first value
+ */
+template<typename T, int Block>
+typename LariatView<T, Block>::const_iterator LariatView<T, Block>::cbegin() const
+{
+    return begin();
+}
+
+/**
+ * @brief returns an iterator one past the last value
+ */
+template<typename T, int Block>
+typename LariatView<T, Block>::const_iterator LariatView<T, Block>::cend() const
+{
+    return end();
+}
+
+/**
+ * @brief returns a reverse iterator to the last value
+ */
+template<typename T, int Block>
+typename LariatView<T, Block>::const_reverse_iterator LariatView<T, Block>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+/**
+ * @brief returns a reverse iterator one before the first value
+ */
+template<typename T, int Block>
+typename LariatView<T, Block>::const_reverse_iterator LariatView<T, Block>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+/**
+ * @brief returns the number of values
+ */
+template<typename T, int Block>
+size_t LariatView<T, Block>::size() const
+{
+    return size_;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file lariat_view.h
+ * @brief LariatView is a read-only lariat over a snapshot file written by Lariat::save.
+ *        The file is memory mapped instead of loaded, so opening it costs the same for
+ *        any size, and processes viewing the same snapshot share its pages. The snapshot
+ *        stores the values packed, without the node table, so a view opens a snapshot
+ *        saved by a lariat of any node size, like Lariat::load does. POSIX only.
+ *
+ * @date 10-14-2026
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+#ifndef LARIAT_VIEW_H
+#define LARIAT_VIEW_H
+////////////////////////////////////////////////////////////////////////////////
+
+#include <iterator> // reverse_iterator
+
+#include "lariat.h" // snapshot header, LariatException, find
+
+// Block is only the number of values find compares at a time, the way Lariat::find compares
+// a node. It has nothing to do with the node size of the lariat that saved the snapshot
+template <typename T, int Block = lariat_page_capacity<T>()>
+class LariatView
+{
+    static_assert(Block > 0, "needs a fixed Block");
+
+    static_assert(std::is_trivially_copyable<T>::value, "snapshots need a trivially copyable type");
+
+    public:
+        // the values are packed, so a pointer walks them in order
+        using const_iterator         = const T*;
+        using iterator               = const_iterator;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        using reverse_iterator       = const_reverse_iterator;
+
+        LariatView();                                  // empty view
+        explicit LariatView(const std::string& path);  // maps a snapshot file
+        LariatView(LariatView&& rhs) noexcept;         // move constructor
+        ~LariatView();                                 // destructor, unmaps the file
+
+        LariatView(const LariatView&) = delete;
+        LariatView& operator=(const LariatView&) = delete;
+
+        // move assignment operator
+        LariatView& operator=(LariatView&& rhs) noexcept;
+
+        void open(const std::string& path); // maps a snapshot file, unmapping the current one
+        void close();                       // unmaps the file, leaving an empty view
+
+        //access
+        const T& operator[](int index) const;
+        const T& first() const;
+        const T& last() const;
+
+        unsigned find(const T& value) const; // returns index, size (one past last) if not found
+
+        // iteration
+        const_iterator         begin() const;
+        const_iterator         end() const;
+        const_iterator         cbegin() const;
+        const_iterator         cend() const;
+        const_reverse_iterator rbegin() const;
+        const_reverse_iterator rend() const;
+
+        size_t size() const; // total number of items
+
+    private:
+        void*    mapping_;     // start of the mapped file
+        size_t   mappingSize_; // length of the mapping
+        const T* values_;      // the packed values in the mapping
+        int      size_;        // the number of values
+};
+
+#include "lariat_view.cpp"
+
+#endif // LARIAT_VIEW_H
@@ -0,0 +1,250 @@
+/**
+ * @file concurrent_lariat_test.cpp
+ * @brief Multi-threaded test of ConcurrentLariat. Readers and writers work on different
+ *        nodes of one list at the same time, then appenders and an eraser change the
+ *        structure while readers walk it, and the final contents are checked.
+ *
+ *        built by the concurrent_lariat_test target and run by ctest, or by hand:
+ *        g++ -std=c++17 -O2 -I.. concurrent_lariat_test.cpp -o concurrent_lariat_test -pthread
+ *        ./concurrent_lariat_test
+ *
+ * @date 10-15-2026
+ */
+
+#include "concurrent_lariat.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const int NODE_SIZE = 16;
+    const int WRITERS = 4;
+    const int READERS = 4;
+
+    // each writer owns this many values, several nodes of them
+    const int VALUES_PER_WRITER = 8 * NODE_SIZE;
+    const int ROUNDS = 200;
+
+    // values appended by each appender and values the eraser takes off the front
+    const int APPENDS = 5000;
+    const int ERASES = 4000;
+
+    using List = ConcurrentLariat<int, NODE_SIZE>;
+
+    std::atomic<bool> failed{false};
+
+    /**
+     * @brief prints what was wrong, from any thread
+     *
+     * @param what - what was wrong
+     */
+    void fail(const std::string& what)
+    {
+        if(!failed.exchange(true))
+        {
+            std::cerr << "concurrent_lariat_test: " << what << "\n";
+        }
+    }
+
+    /**
+     * @brief writers overwrite their own range of values with set while readers get and find
+     *        values all over the list. The count of every node stays the same, so each index
+     *        keeps its meaning and a value read at an index is always index + round * stride
+     */
+    void set_while_reading()
+    {
+        const int total = WRITERS * VALUES_PER_WRITER;
+
+        List list;
+
+        for(int i = 0; i < total; ++i)
+        {
+            list.push_back(i);
+        }
+
+        std::atomic<int> writersDone{0};
+        std::vector<std::thread> threads;
+
+        for(int writer = 0; writer < WRITERS; ++writer)
+        {
+            threads.emplace_back([&, writer]
+            {
+                for(int round = 1; round <= ROUNDS; ++round)
+                {
+                    for(int i = writer * VALUES_PER_WRITER; i < (writer + 1) * VALUES_PER_WRITER; ++i)
+                    {
+                        list.set(i, i + round * total);
+                    }
+                }
+
+                writersDone++;
+            });
+        }
+
+        for(int reader = 0; reader < READERS; ++reader)
+        {
+            threads.emplace_back([&, reader]
+            {
+                unsigned index = reader;
+
+                while(writersDone.load() < WRITERS && !failed.load())
+                {
+                    index = (index * 7 + 13) % total;
+
+                    int value = list.get(index);
+
+                    if(value % total != static_cast<int>(index))
+                    {
+                        fail("get(" + std::to_string(index) + ") returned " + std::to_string(value));
+                    }
+
+                    // the value can be overwritten before the walk reaches it, then it is a miss
+                    unsigned found = list.find(value);
+
+                    if(found != index && found != List::NOT_FOUND)
+                    {
+                        fail("find(" + std::to_string(value) + ") returned " + std::to_string(found));
+                    }
+
+                    if(list.find(-1) != List::NOT_FOUND)
+                    {
+                        fail("find of a missing value didn't return NOT_FOUND");
+                    }
+                }
+            });
+        }
+
+        for(std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for(int i = 0; i < total; ++i)
+        {
+            if(list.get(i) != i + ROUNDS * total)
+            {
+                fail("final value at " + std::to_string(i) + " is " + std::to_string(list.get(i)));
+
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief appenders push sequenced values on the back while an eraser takes the values
+     *        put there beforehand off the front and readers walk the list, so the front and
+     *        the back nodes change at once. Each appender's values must stay in the order it
+     *        pushed them, and only the values put there beforehand may be erased
+     */
+    void append_while_erasing()
+    {
+        List list;
+
+        // negative values in front, the eraser takes all but the last of them
+        for(int i = 0; i < ERASES + 1; ++i)
+        {
+            list.push_back(-1 - i);
+        }
+
+        std::atomic<bool> done{false};
+        std::vector<std::thread> threads;
+
+        for(int appender = 0; appender < WRITERS; ++appender)
+        {
+            threads.emplace_back([&, appender]
+            {
+                for(int i = 0; i < APPENDS; ++i)
+                {
+                    list.push_back(appender * APPENDS + i);
+                }
+            });
+        }
+
+        threads.emplace_back([&]
+        {
+            for(int i = 0; i < ERASES; ++i)
+            {
+                list.erase(0);
+            }
+        });
+
+        std::thread reader([&]
+        {
+            while(!done.load() && !failed.load())
+            {
+                // the last front value is never erased, and nothing is ever inserted before it
+                if(list.find(-1 - ERASES) == List::NOT_FOUND)
+                {
+                    fail("find lost the last front value");
+                }
+
+                size_t size = list.size();
+
+                if(size == 0)
+                {
+                    fail("size() was 0");
+                }
+            }
+        });
+
+        for(std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        done = true;
+        reader.join();
+
+        const size_t expected = 1 + static_cast<size_t>(WRITERS) * APPENDS;
+
+        if(list.size() != expected)
+        {
+            fail("size " + std::to_string(list.size()) + " instead of " + std::to_string(expected));
+
+            return;
+        }
+
+        // the erased front left empty nodes behind, compact takes them out and keeps the order
+        list.compact();
+
+        if(list.get(0) != -1 - ERASES)
+        {
+            fail("first value is " + std::to_string(list.get(0)));
+        }
+
+        std::vector<int> next(WRITERS, 0);
+
+        for(size_t i = 1; i < expected; ++i)
+        {
+            int value = list.get(static_cast<int>(i));
+            int appender = value / APPENDS;
+
+            if(value < 0 || appender >= WRITERS || value % APPENDS != next[appender]++)
+            {
+                fail("value " + std::to_string(value) + " at " + std::to_string(i) + " is out of order");
+
+                return;
+            }
+        }
+    }
+}
+
+int main()
+{
+    set_while_reading();
+    append_while_erasing();
+
+    if(failed.load())
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "concurrent_lariat_test passed\n";
+
+    return EXIT_SUCCESS;
+}
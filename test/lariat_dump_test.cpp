@@ -0,0 +1,153 @@
+/**
+ * @file lariat_dump_test.cpp
+ * @brief Tests that Lariat::dump and the operator<< built on it write what writing each
+ *        value to the stream with its own operator<< writes, for streams with the default
+ *        format, with other integer flags and with a locale that groups digits.
+ *
+ *        built by the lariat_dump_test target and run by ctest, or by hand:
+ *        g++ -std=c++17 -O2 -I.. lariat_dump_test.cpp -o lariat_dump_test
+ *        ./lariat_dump_test
+ *
+ * @date 10-15-2026
+ */
+
+#include "lariat.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <locale>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    int failures = 0;
+
+    // groups digits by thousands with a comma, like many named locales do
+    struct Thousands : std::numpunct<char>
+    {
+        char do_thousands_sep() const override { return ','; }
+        std::string do_grouping() const override { return "\3"; }
+    };
+
+    /**
+     * @brief writes a list the way dump does, one operator<< of the stream at a time. The
+     *        list must be packed, every node full but the last
+     *
+     * @param os - stream to write to
+     * @param list - list to write
+     * @param format - values only, or every node with its count and the index of each value
+     */
+    template<typename T, int Size>
+    void write_each(std::ostream& os, const Lariat<T, Size>& list, LariatDumpFormat format)
+    {
+        int size = static_cast<int>(list.size());
+
+        for(int index = 0; index < size; )
+        {
+            int count = std::min(list.node_capacity(), size - index);
+
+            if(format == DUMP_NODES)
+            {
+                os << "Node starting (count " << count << ")\n";
+            }
+
+            for(int end = index + count; index < end; ++index)
+            {
+                if(format == DUMP_NODES)
+                {
+                    os << index << " -> ";
+                }
+
+                os << list[index] << '\n';
+            }
+
+            if(format == DUMP_NODES)
+            {
+                os << "-----------\n";
+            }
+        }
+    }
+
+    /**
+     * @brief checks dump in both formats against writing each value, on two streams set up the same way
+     *
+     * @param list - list to write
+     * @param setup - sets the flags or the locale of a stream
+     * @param name - the stream setup in messages
+     */
+    template<typename T, int Size>
+    void check_dump(const Lariat<T, Size>& list, const std::function<void(std::ostream&)>& setup, const std::string& name)
+    {
+        for(LariatDumpFormat format : { DUMP_VALUES, DUMP_NODES })
+        {
+            std::ostringstream dumped;
+            std::ostringstream expected;
+
+            setup(dumped);
+            setup(expected);
+
+            if(format == DUMP_NODES)
+            {
+                dumped << list;
+            }
+            else
+            {
+                list.dump(dumped, format);
+            }
+
+            write_each(expected, list, format);
+
+            if(dumped.str() != expected.str())
+            {
+                std::cerr << "lariat_dump_test: " << (format == DUMP_NODES ? "operator<<" : "dump") << " differs with " << name << "\n";
+                failures++;
+            }
+        }
+    }
+
+    /**
+     * @brief checks a list with every stream setup
+     */
+    template<typename T, int Size>
+    void check_setups(Lariat<T, Size>& list, const std::string& name)
+    {
+        // packed, so write_each knows where the nodes start
+        list.compact();
+
+        check_dump(list, [](std::ostream&) {}, name + ", default format");
+        check_dump(list, [](std::ostream& os) { os << std::hex; }, name + ", hex");
+        check_dump(list, [](std::ostream& os) { os << std::showpos; }, name + ", showpos");
+        check_dump(list, [](std::ostream& os) { os.imbue(std::locale(std::locale::classic(), new Thousands)); }, name + ", grouping locale");
+    }
+}
+
+int main()
+{
+    // large values so the grouping shows, negative ones so the sign does, over several nodes
+    Lariat<int, 16> ints;
+    Lariat<long long, 7> longs;
+    Lariat<double, 16> doubles;
+
+    for(int i = 0; i < 300; ++i)
+    {
+        ints.insert(static_cast<int>((i * 37u) % (ints.size() + 1)), (i % 2 == 0 ? 1 : -1) * i * 104729);
+        longs.push_back(static_cast<long long>(i) * 1000000007LL - 5000000000LL);
+        doubles.push_back(i * 1234.5);
+    }
+
+    check_setups(ints, "Lariat<int, 16>");
+    check_setups(longs, "Lariat<long long, 7>");
+    check_setups(doubles, "Lariat<double, 16>");
+
+    if(failures > 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "lariat_dump_test passed\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file lariat_queue_test.cpp
+ * @brief Tests LariatQueue with a producer and a consumer thread. The producer pushes
+ *        sequenced values through small nodes, so every node is reused many times, and the
+ *        consumer checks it gets each value once and in order. Then checks that the values
+ *        left in a queue are destroyed with it.
+ *
+ *        built by the lariat_queue_test target and run by ctest, or by hand:
+ *        g++ -std=c++17 -O2 -I.. lariat_queue_test.cpp -o lariat_queue_test -pthread
+ *        ./lariat_queue_test [values]
+ *
+ *        to look for races, configure with -DCMAKE_CXX_FLAGS=-fsanitize=thread and run ctest
+ *
+ * @date 10-15-2026
+ */
+
+#include "lariat_queue.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace
+{
+    // values in a node, small so the producer laps the consumer's finished nodes often
+    const int NODE_SIZE = 8;
+
+    int failures = 0;
+
+    /**
+     * @brief prints a failed check
+     *
+     * @param passed - result of the check
+     * @param what - what was checked
+     */
+    void check(bool passed, const std::string& what)
+    {
+        if(!passed)
+        {
+            std::cerr << "lariat_queue_test: " << what << "\n";
+            failures++;
+        }
+    }
+
+    // a sequence number on the heap, counted while it is alive. A value popped twice or
+    // destroyed twice shows as a wrong count, one read after it was destroyed as a bad number
+    struct Sequenced
+    {
+        static std::atomic<long> alive;
+
+        std::unique_ptr<uint64_t> number;
+
+        Sequenced() { alive++; }
+        explicit Sequenced(uint64_t n) : number(new uint64_t(n)) { alive++; }
+        Sequenced(Sequenced&& rhs) noexcept : number(std::move(rhs.number)) { alive++; }
+        Sequenced& operator=(Sequenced&& rhs) noexcept { number = std::move(rhs.number); return *this; }
+        ~Sequenced() { alive--; }
+    };
+
+    std::atomic<long> Sequenced::alive{0};
+
+    /**
+     * @brief pushes values from one thread and pops them on another, the consumer checks it
+     *        gets 0 to count - 1 in order with none lost or repeated
+     *
+     * @param count - number of values to push
+     */
+    void producer_consumer(uint64_t count)
+    {
+        {
+            LariatQueue<Sequenced, NODE_SIZE> queue;
+
+            std::thread producer([&]
+            {
+                for(uint64_t i = 0; i < count; ++i)
+                {
+                    // mix both ways of pushing
+                    if(i % 2 == 0)
+                    {
+                        queue.push(Sequenced(i));
+                    }
+                    else
+                    {
+                        queue.emplace(i);
+                    }
+                }
+            });
+
+            uint64_t expected = 0;
+            uint64_t wrong = 0;
+            Sequenced value;
+
+            while(expected < count)
+            {
+                // front agrees with the value popped after it
+                Sequenced* front = queue.front();
+
+                if(front == nullptr)
+                {
+                    std::this_thread::yield();
+
+                    continue;
+                }
+
+                uint64_t seen = *front->number;
+
+                if(!queue.try_pop(value) || value.number == nullptr || *value.number != seen || seen != expected)
+                {
+                    wrong++;
+                }
+
+                expected++;
+            }
+
+            producer.join();
+
+            check(wrong == 0, std::to_string(wrong) + " values were lost, repeated or out of order");
+            check(queue.empty() && queue.front() == nullptr && !queue.try_pop(value), "the queue isn't empty after popping every value");
+        }
+
+        check(Sequenced::alive.load() == 0, std::to_string(Sequenced::alive.load()) + " values alive after the queue was destroyed");
+    }
+
+    /**
+     * @brief destroys queues with values left in them, in the head node, in full nodes after
+     *        it and in nodes reused after popping
+     */
+    void destroyed_with_values()
+    {
+        for(int left : { 1, NODE_SIZE - 1, NODE_SIZE, 3 * NODE_SIZE + 2 })
+        {
+            {
+                LariatQueue<Sequenced, NODE_SIZE> queue;
+                Sequenced value;
+
+                // fill and drain a few nodes first, so some of the nodes are reused
+                for(int round = 0; round < 3; ++round)
+                {
+                    for(int i = 0; i < 2 * NODE_SIZE + 1; ++i)
+                    {
+                        queue.push(Sequenced(i));
+                    }
+
+                    while(queue.try_pop(value))
+                    {
+                    }
+                }
+
+                for(int i = 0; i < left; ++i)
+                {
+                    queue.push(Sequenced(i));
+                }
+
+                // pop one so the head starts past its first slot
+                check(queue.try_pop(value) && *value.number == 0, "wrong first value after reuse");
+                // the ones still queued and the one popped
+                check(Sequenced::alive.load() == left, "values alive before destroying the queue don't match what is queued");
+            }
+
+            check(Sequenced::alive.load() == 0, "~LariatQueue left " + std::to_string(Sequenced::alive.load()) + " of " + std::to_string(left) + " queued values alive");
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    uint64_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    producer_consumer(count);
+    destroyed_with_values();
+
+    if(failures > 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "lariat_queue_test passed\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,380 @@
+/**
+ * @file lariat_snapshot_test.cpp
+ * @brief Tests of the binary snapshots written by Lariat::save. Round trips lists of
+ *        several nodes through a stream and a file, into lariats of the same and of other
+ *        node sizes, checks that load rejects snapshots that aren't for its value type
+ *        or were cut short without keeping nodes for a count it never read, and reads a snapshot through LariatView.
+ *
+ *        built by the lariat_snapshot_test target and run by ctest, or by hand:
+ *        g++ -std=c++17 -O2 -I.. lariat_snapshot_test.cpp -o lariat_snapshot_test
+ *        ./lariat_snapshot_test
+ *
+ * @date 10-15-2026
+ */
+
+#include "lariat.h"
+#include "lariat_view.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace
+{
+    int failures = 0;
+
+    /**
+     * @brief prints a failed check
+     *
+     * @param passed - result of the check
+     * @param what - what was checked
+     */
+    void check(bool passed, const std::string& what)
+    {
+        if(!passed)
+        {
+            std::cerr << "lariat_snapshot_test: " << what << "\n";
+            failures++;
+        }
+    }
+
+    /**
+     * @brief returns true if a list holds the values of a vector, in order
+     */
+    template<typename T, int Size>
+    bool same_values(const Lariat<T, Size>& list, const std::vector<T>& values)
+    {
+        return list.size() == values.size() && std::equal(list.begin(), list.end(), values.begin());
+    }
+
+    /**
+     * @brief returns the number of nodes that count values fill completely, the last one partly
+     */
+    int full_nodes(size_t count, int capacity)
+    {
+        return static_cast<int>((count + capacity - 1) / capacity);
+    }
+
+    /**
+     * @brief returns a list of several nodes that aren't full, built by inserts in the middle
+     *
+     * @param values - gets the values of the list in order
+     */
+    Lariat<int, 16> partly_full_list(std::vector<int>& values)
+    {
+        Lariat<int, 16> list;
+
+        for(int i = 0; i < 1000; ++i)
+        {
+            int index = static_cast<int>((i * 7919u) % (values.size() + 1));
+
+            list.insert(index, i);
+            values.insert(values.begin() + index, i);
+        }
+
+        return list;
+    }
+
+    /**
+     * @brief runs a load that must throw E_DATA_ERROR
+     *
+     * @param load - the load
+     * @param what - what the snapshot was wrong with
+     */
+    template<typename Load>
+    void check_rejected(Load load, const std::string& what)
+    {
+        int code = -1;
+
+        try
+        {
+            load();
+        }
+        catch(const LariatException& e)
+        {
+            code = e.code();
+        }
+
+        check(code == LariatException::E_DATA_ERROR, "a snapshot with " + what + " wasn't rejected with E_DATA_ERROR");
+    }
+
+    // reads a string through a buffer that can't seek, like a pipe
+    struct UnseekableBuffer : std::streambuf
+    {
+        explicit UnseekableBuffer(std::string& bytes)
+        {
+            setg(&bytes[0], &bytes[0], &bytes[0] + bytes.size());
+        }
+    };
+
+    /**
+     * @brief saves a list of partly full nodes and loads it into lariats of the same and of
+     *        other sizes. The values come back in order and every node but the last is full
+     */
+    void round_trip()
+    {
+        std::vector<int> values;
+        Lariat<int, 16> list = partly_full_list(values);
+
+        check(list.stats().nodeCount > full_nodes(values.size(), 16), "the saved list should have partly full nodes");
+
+        std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+
+        list.save(stream);
+
+        Lariat<int, 16> same;
+
+        same.load(stream);
+
+        check(same_values(same, values), "a stream round trip changed the values");
+        check(same.stats().nodeCount == full_nodes(values.size(), 16), "load didn't fill every node");
+
+        // a lariat of another size reads the same snapshot
+        stream.clear();
+        stream.seekg(0);
+
+        Lariat<int, 7> other;
+
+        other.load(stream);
+
+        check(same_values(other, values), "loading into another Size changed the values");
+        check(other.stats().nodeCount == full_nodes(values.size(), 7), "load into another Size didn't fill every node");
+
+        Lariat<int, LARIAT_DYNAMIC_SIZE> dynamic(100);
+
+        stream.clear();
+        stream.seekg(0);
+        dynamic.load(stream);
+
+        check(same_values(dynamic, values), "loading into a dynamic size changed the values");
+        check(dynamic.stats().nodeCount == full_nodes(values.size(), 100), "load into a dynamic size didn't fill every node");
+
+        // load replaces what was there, and an empty list round trips to an empty list
+        std::stringstream empty(std::ios::in | std::ios::out | std::ios::binary);
+
+        Lariat<int, 16>().save(empty);
+        same.load(empty);
+
+        check(same.size() == 0 && same.stats().nodeCount == 0, "an empty snapshot didn't load as an empty list");
+    }
+
+    /**
+     * @brief saves to a file and loads it back by path
+     */
+    void file_round_trip()
+    {
+        std::vector<int> values;
+        Lariat<int, 16> list = partly_full_list(values);
+
+        std::string path = (std::filesystem::temp_directory_path() / "lariat_snapshot_test.bin").string();
+
+        list.save(path);
+
+        Lariat<int, 16> loaded;
+
+        loaded.load(path);
+
+        check(same_values(loaded, values), "a file round trip changed the values");
+        check(loaded.stats().nodeCount == full_nodes(values.size(), 16), "load from a file didn't fill every node");
+
+        std::remove(path.c_str());
+
+        check_rejected([&]{ loaded.load(path); }, "a missing file");
+    }
+
+    /**
+     * @brief loads snapshots that are for another type, damaged or cut short. A bad header
+     *        leaves the list as it was, a short payload leaves it empty
+     */
+    void rejected()
+    {
+        std::vector<int> values;
+        Lariat<int, 16> list = partly_full_list(values);
+
+        std::ostringstream saved(std::ios::binary);
+
+        list.save(saved);
+
+        const std::string snapshot = saved.str();
+
+        std::vector<int> kept = { 1, 2, 3 };
+        Lariat<int, 16> target(kept.begin(), kept.end());
+
+        auto load = [&](const std::string& bytes)
+        {
+            std::istringstream stream(bytes, std::ios::binary);
+
+            target.load(stream);
+        };
+
+        std::string badMagic = snapshot;
+
+        badMagic[0] = 'X';
+
+        check_rejected([&]{ load(badMagic); }, "a bad magic");
+        check(same_values(target, kept), "a bad magic changed the list");
+
+        std::string badVersion = snapshot;
+
+        badVersion[offsetof(LariatSnapshotHeader, version)]++;
+
+        check_rejected([&]{ load(badVersion); }, "another format version");
+        check(same_values(target, kept), "another format version changed the list");
+
+        check_rejected([&]{ load(snapshot.substr(0, sizeof(LariatSnapshotHeader) - 1)); }, "a truncated header");
+        check(same_values(target, kept), "a truncated header changed the list");
+
+        // the value size doesn't match
+        check_rejected([&]{
+            std::istringstream stream(snapshot, std::ios::binary);
+            Lariat<double, 16> doubles;
+
+            doubles.load(stream);
+        }, "another value size");
+
+        check_rejected([&]{ load(snapshot.substr(0, snapshot.size() - 1)); }, "a truncated payload");
+        check(target.size() == 0 && target.stats().nodeCount == 0, "a truncated payload didn't leave the list empty");
+    }
+
+    /**
+     * @brief loads a snapshot whose header counts far more values than it holds, from a
+     *        stream that can seek and one that can't. Neither reserves nodes for the count,
+     *        and the pool is empty again after the load fails
+     */
+    void oversized_count()
+    {
+        std::vector<int> values;
+        Lariat<int, 16> list = partly_full_list(values);
+
+        std::ostringstream saved(std::ios::binary);
+
+        list.save(saved);
+
+        std::string snapshot = saved.str();
+        uint64_t count = 300000000;
+
+        std::memcpy(&snapshot[offsetof(LariatSnapshotHeader, count)], &count, sizeof(count));
+
+        Lariat<int, 16> seekable;
+
+        check_rejected([&]{
+            std::istringstream stream(snapshot, std::ios::binary);
+
+            seekable.load(stream);
+        }, "a count past the end of a seekable stream");
+        check(seekable.size() == 0 && seekable.stats().pooledNodes == 0 && seekable.stats().bytesUsed == sizeof(seekable), "a count past the end of a seekable stream left nodes in the pool");
+
+        Lariat<int, 16> unseekable;
+
+        check_rejected([&]{
+            UnseekableBuffer buffer(snapshot);
+            std::istream stream(&buffer);
+
+            unseekable.load(stream);
+        }, "a count past the end of a stream that can't seek");
+        check(unseekable.size() == 0 && unseekable.stats().pooledNodes == 0 && unseekable.stats().bytesUsed == sizeof(unseekable), "a count past the end of a stream that can't seek left nodes in the pool");
+    }
+
+    /**
+     * @brief checks a view of a snapshot against the list that saved it, by index, find,
+     *        iteration both ways and size
+     *
+     * @param view - view of the snapshot
+     * @param list - list that saved it
+     * @param name - the view type in messages
+     */
+    template<typename View, typename T, int Size>
+    void check_view(const View& view, const Lariat<T, Size>& list, const std::string& name)
+    {
+        check(view.size() == list.size(), name + " size differs");
+
+        if(view.size() != list.size())
+        {
+            return;
+        }
+
+        bool indexed = true;
+
+        for(int i = 0; i < static_cast<int>(list.size()); ++i)
+        {
+            indexed = indexed && view[i] == list[i];
+        }
+
+        check(indexed, name + " operator[] differs");
+        check(std::equal(view.begin(), view.end(), list.begin(), list.end()), name + " iteration differs");
+        check(std::equal(view.rbegin(), view.rend(), list.rbegin(), list.rend()), name + " reverse iteration differs");
+        check(view.first() == list.first() && view.last() == list.last(), name + " first or last differs");
+
+        // every value, and one that isn't there
+        bool found = true;
+
+        for(int i = 0; i < static_cast<int>(list.size()); i += 13)
+        {
+            found = found && view.find(list[i]) == list.find(list[i]);
+        }
+
+        check(found, name + " find differs");
+        check(view.find(-1) == view.size(), name + " find of a missing value didn't return size");
+    }
+
+    /**
+     * @brief saves a list and opens the file with views that scan in blocks of other sizes
+     *        than the nodes of the list, since the snapshot doesn't depend on the node size
+     */
+    void view()
+    {
+        std::vector<int> values;
+        Lariat<int, 16> list = partly_full_list(values);
+
+        std::string path = (std::filesystem::temp_directory_path() / "lariat_snapshot_view_test.bin").string();
+
+        list.save(path);
+
+        check_view(LariatView<int, 16>(path), list, "LariatView<int, 16>");
+        check_view(LariatView<int, 5>(path), list, "LariatView<int, 5>");
+        check_view(LariatView<int>(path), list, "LariatView<int>");
+
+        // a view is moved and closed like a file
+        LariatView<int> moved(path);
+        LariatView<int> target(std::move(moved));
+
+        check(moved.size() == 0 && target.size() == list.size(), "moving a view didn't take the mapping");
+
+        target.close();
+
+        check(target.size() == 0 && target.begin() == target.end(), "close didn't leave the view empty");
+
+        check_rejected([&]{ LariatView<double> doubles(path); }, "another value size, through a view,");
+
+        std::remove(path.c_str());
+
+        check_rejected([&]{ LariatView<int> missing(path); }, "a missing file, through a view,");
+    }
+}
+
+int main()
+{
+    round_trip();
+    file_round_trip();
+    rejected();
+    oversized_count();
+    view();
+
+    if(failures > 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "lariat_snapshot_test passed\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,1240 @@
+/**
+ * @file lariat_stress.cpp
+ * @brief Randomized differential test. Runs long mixed sequences of operations on lariats
+ *        of several node sizes and the same operations on a std::vector, and checks that
+ *        both hold the same values as it goes. Every operation is timed and the heap
+ *        allocations it makes are counted, the report at the end gives the p50/p99 latency
+ *        and allocations of each operation type, and the node counters of each lariat.
+ *        Snapshots, views, dumps and the parallel scans are checked against the vector
+ *        too, and a last section runs LariatQueue, ConcurrentLariat and the parallel scans
+ *        on several threads.
+ *
+ *        built by the lariat_stress target and run by ctest, or by hand:
+ *        g++ -std=c++17 -O2 -DLARIAT_STATS -I.. lariat_stress.cpp -o lariat_stress -pthread
+ *        ./lariat_stress [operations] [seed]
+ *
+ * @date 10-14-2026
+ */
+
+#include "lariat.h"
+#include "lariat_parallel.h"
+#include "lariat_view.h"
+#include "lariat_queue.h"
+#include "concurrent_lariat.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    // every heap allocation of the process, counted by the operator new below from any thread
+    std::atomic<size_t> allocations{0};
+}
+
+void* operator new(std::size_t bytes)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+
+    void* memory = std::malloc(bytes > 0 ? bytes : 1);
+
+    if(memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void* operator new(std::size_t bytes, std::align_val_t alignment)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+
+    // aligned_alloc takes a multiple of the alignment
+    size_t align = static_cast<size_t>(alignment);
+    void* memory = std::aligned_alloc(align, (std::max<size_t>(bytes, 1) + align - 1) / align * align);
+
+    if(memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    enum Operation
+    {
+        PUSH_BACK, PUSH_FRONT, POP_BACK, POP_FRONT, INSERT, INSERT_RANGE, INSERT_COUNT,
+        ERASE, ERASE_RANGE, ERASE_IF, INDEX, CONST_INDEX, FIND, SPLIT_SPLICE, APPEND, COPY, ASSIGN,
+        RESERVE_PUSH, COMPACT_STEP, COMPACT, INSERT_SORTED, LOWER_BOUND, BAD_INDEX, SET_POLICY,
+        APPENDER, SAVE_LOAD, VIEW, PARALLEL_FIND, PARALLEL_COUNT_IF, DUMP,
+        OPERATIONS
+    };
+
+    const char* const operationNames[OPERATIONS] = {
+        "push_back", "push_front", "pop_back", "pop_front", "insert", "insert range", "insert count",
+        "erase", "erase range", "erase_if", "operator[]", "const operator[]", "find", "split_at + splice", "append", "copy", "assign",
+        "reserve + push_back", "compact_step", "compact", "insert_sorted", "lower_bound", "bad index", "set policy",
+        "appender", "save + load", "view", "parallel_find", "parallel_count_if", "dump"
+    };
+
+    // how often each operation is picked while the list grows and while it shrinks
+    const double growWeights[OPERATIONS] = {
+        14, 10, 3, 3, 8, 2, 1,
+        4, 1, 0.2, 8, 4, 2, 1, 1, 0.1, 0.05,
+        0.3, 2, 0.1, 3, 3, 0.5, 0.2,
+        1, 0.05, 0.05, 0.2, 0.2, 0.05
+    };
+
+    const double shrinkWeights[OPERATIONS] = {
+        3, 3, 10, 10, 2, 0.5, 0.5,
+        12, 2, 0.5, 8, 4, 2, 1, 0.2, 0.1, 0.05,
+        0.1, 2, 0.1, 1, 3, 0.5, 0.2,
+        0.2, 0.05, 0.05, 0.2, 0.2, 0.05
+    };
+
+    // operations before the list switches between growing and shrinking
+    const int PHASE_LENGTH = 6000;
+
+    // the sorted list is cut in half when it grows past this
+    const size_t SORTED_LIMIT = 4096;
+
+    // values passed between the threads of the threaded section
+    const int THREADED_VALUES = 200000;
+
+    // timings and allocations of one operation type
+    struct OperationRecord
+    {
+        std::vector<uint32_t> nanoseconds;
+        size_t allocations = 0;
+    };
+
+    template<typename T>
+    T make_value(unsigned seed);
+
+    // a small range so find and the sorted operations see equal values
+    template<>
+    int make_value<int>(unsigned seed)
+    {
+        return static_cast<int>(seed % 4096);
+    }
+
+    // every third value is too long for the small string buffer, so moves of it matter
+    template<>
+    std::string make_value<std::string>(unsigned seed)
+    {
+        std::string value = std::to_string(seed % 4096);
+
+        return seed % 3 == 0 ? value + " is a value long enough to live on the heap" : value;
+    }
+
+    template<typename T, int Size>
+    class Stress
+    {
+        using List = Lariat<T, Size>;
+
+        public:
+            Stress(const std::string& name, unsigned seed, int nodeCapacity = 0);
+
+            bool run(int operations); // false and a message on the first mismatch
+            void report() const;      // latency and allocations of each operation type
+
+        private:
+            bool step(Operation operation);
+            bool check_all();
+            bool fail(const std::string& what);
+
+            List empty_list() const;
+            std::string snapshot_path() const; // a file for the snapshot operations
+            T next_value();
+            int random_index(size_t size); // 0 to size, both included
+
+            // times a call and counts what it allocates
+            template<typename Function>
+            void measure(Operation operation, Function function);
+
+            std::string name_;
+            unsigned seed_;
+            int nodeCapacity_;
+            std::mt19937 random_;
+
+            List list_;
+            std::vector<T> model_;
+            List sorted_;
+            std::vector<T> sortedModel_;
+
+            int stepIndex_;
+            Operation current_;
+            int lastIndex_; // operator[] walks from here so the finger is used
+            OperationRecord records_[OPERATIONS];
+    };
+
+    /**
+     * @brief Construct a test of one lariat type
+     *
+     * @param name - name of the type in the report
+     * @param seed - seed of the operation sequence
+     * @param nodeCapacity - node capacity for LARIAT_DYNAMIC_SIZE
+     */
+    template<typename T, int Size>
+    Stress<T, Size>::Stress(const std::string& name, unsigned seed, int nodeCapacity) : name_(name), seed_(seed), nodeCapacity_(nodeCapacity), random_(seed),
+                                                                                         list_(empty_list()), sorted_(empty_list()), stepIndex_(0), current_(PUSH_BACK), lastIndex_(0)
+    {
+
+    }
+
+    /**
+     * @brief runs a sequence of random operations, checking the list against the vector after
+     *        each one and all of it every so often
+     *
+     * @param operations - number of operations
+     * @return true - the list matched the vector the whole time
+     * @return false - it didn't, a message was printed
+     */
+    template<typename T, int Size>
+    bool Stress<T, Size>::run(int operations)
+    {
+        std::discrete_distribution<int> grow(std::begin(growWeights), std::end(growWeights));
+        std::discrete_distribution<int> shrink(std::begin(shrinkWeights), std::end(shrinkWeights));
+
+        for(stepIndex_ = 0; stepIndex_ < operations; ++stepIndex_)
+        {
+            bool growing = (stepIndex_ / PHASE_LENGTH) % 2 == 0;
+
+            current_ = static_cast<Operation>(growing ? grow(random_) : shrink(random_));
+
+            try
+            {
+                if(!step(current_))
+                {
+                    return false;
+                }
+            }
+            catch(const LariatException& e)
+            {
+                return fail(std::string("unexpected exception: ") + e.what());
+            }
+
+            if(list_.size() != model_.size())
+            {
+                return fail("size " + std::to_string(list_.size()) + " instead of " + std::to_string(model_.size()));
+            }
+
+            if(stepIndex_ % 256 == 0 && !check_all())
+            {
+                return false;
+            }
+        }
+
+        return check_all();
+    }
+
+    /**
+     * @brief does one operation on the list and the vector and checks its result
+     *
+     * @param operation - operation to do
+     * @return - false if the result was wrong
+     */
+    template<typename T, int Size>
+    bool Stress<T, Size>::step(Operation operation)
+    {
+        size_t size = model_.size();
+
+        switch(operation)
+        {
+            case PUSH_BACK:
+            {
+                T value = next_value();
+
+                model_.push_back(value);
+                measure(operation, [&]{ list_.push_back(std::move(value)); });
+
+                return list_.last() == model_.back() || fail("wrong last value");
+            }
+            case PUSH_FRONT:
+            {
+                T value = next_value();
+
+                model_.insert(model_.begin(), value);
+                measure(operation, [&]{ list_.push_front(std::move(value)); });
+
+                return list_.first() == model_.front() || fail("wrong first value");
+            }
+            case POP_BACK:
+            {
+                // popping an empty list does nothing
+                measure(operation, [&]{ list_.pop_back(); });
+
+                if(!model_.empty())
+                {
+                    model_.pop_back();
+                }
+
+                return model_.empty() || list_.last() == model_.back() || fail("wrong last value");
+            }
+            case POP_FRONT:
+            {
+                measure(operation, [&]{ list_.pop_front(); });
+
+                if(!model_.empty())
+                {
+                    model_.erase(model_.begin());
+                }
+
+                return model_.empty() || list_.first() == model_.front() || fail("wrong first value");
+            }
+            case INSERT:
+            {
+                int index = random_index(size);
+                T value = next_value();
+
+                model_.insert(model_.begin() + index, value);
+                measure(operation, [&]{ list_.insert(index, std::move(value)); });
+
+                return list_[index] == model_[index] || fail("wrong value at " + std::to_string(index));
+            }
+            case INSERT_RANGE:
+            {
+                int index = random_index(size);
+                std::vector<T> values(random_() % (3 * list_.node_capacity() + 1));
+
+                for(T& value : values)
+                {
+                    value = next_value();
+                }
+
+                model_.insert(model_.begin() + index, values.begin(), values.end());
+                measure(operation, [&]{ list_.insert(index, values.begin(), values.end()); });
+
+                return true;
+            }
+            case INSERT_COUNT:
+            {
+                int index = random_index(size);
+                int count = static_cast<int>(random_() % (2 * list_.node_capacity() + 1));
+                T value = next_value();
+
+                model_.insert(model_.begin() + index, count, value);
+                measure(operation, [&]{ list_.insert(index, count, value); });
+
+                return true;
+            }
+            case ERASE:
+            {
+                if(size == 0)
+                {
+                    return true;
+                }
+
+                int index = random_index(size - 1);
+
+                model_.erase(model_.begin() + index);
+                measure(operation, [&]{ list_.erase(index); });
+
+                return index == static_cast<int>(model_.size()) || list_[index] == model_[index] || fail("wrong value at " + std::to_string(index));
+            }
+            case ERASE_RANGE:
+            {
+                // mostly short ranges, sometimes across many nodes
+                int first = random_index(size);
+                int length = random_() % 8 == 0 ? random_index(size - first) : std::min(random_index(2 * list_.node_capacity()), static_cast<int>(size) - first);
+
+                model_.erase(model_.begin() + first, model_.begin() + first + length);
+                measure(operation, [&]{ list_.erase(first, first + length); });
+
+                return true;
+            }
+            case ERASE_IF:
+            {
+                // erases about one value in a few, and sometimes throws part way
+                size_t divisor = 1 + random_() % 8;
+                size_t throwAt = random_() % 4 == 0 ? random_index(size) : size + 1;
+                size_t calls = 0;
+                size_t erased = 0;
+                bool threw = false;
+
+                auto predicate = [&](const T& value)
+                {
+                    if(calls++ == throwAt)
+                    {
+                        throw LariatException(LariatException::E_DATA_ERROR, "predicate failed");
+                    }
+
+                    return std::hash<T>()(value) % divisor == 0;
+                };
+
+                measure(operation, [&]{
+                    try
+                    {
+                        erased = list_.erase_if(predicate);
+                    }
+                    catch(const LariatException&)
+                    {
+                        threw = true;
+                    }
+                });
+
+                // the values the predicate ran on before it threw are filtered, the rest are kept
+                size_t filtered = std::min(throwAt, size);
+                auto kept = std::remove_if(model_.begin(), model_.begin() + filtered, [&](const T& value) { return std::hash<T>()(value) % divisor == 0; });
+                size_t expected = (model_.begin() + filtered) - kept;
+
+                model_.erase(kept, model_.begin() + filtered);
+
+                if(threw != (throwAt < size))
+                {
+                    return fail(threw ? "erase_if threw" : "erase_if didn't throw");
+                }
+
+                if(threw)
+                {
+                    return true;
+                }
+
+                // the nodes are packed like after compact
+                int capacity = list_.node_capacity();
+                int nodes = static_cast<int>((model_.size() + capacity - 1) / capacity);
+
+                if(list_.stats().nodeCount != nodes)
+                {
+                    return fail("erase_if left " + std::to_string(list_.stats().nodeCount) + " nodes instead of " + std::to_string(nodes));
+                }
+
+                return erased == expected || fail("erase_if erased " + std::to_string(erased) + " instead of " + std::to_string(expected));
+            }
+            case INDEX:
+            {
+                if(size == 0)
+                {
+                    return true;
+                }
+
+                // near the last index, like a scan would
+                int index = std::clamp(lastIndex_ + static_cast<int>(random_() % 33) - 16, 0, static_cast<int>(size) - 1);
+                const T* value = nullptr;
+
+                measure(operation, [&]{ value = &list_[index]; });
+
+                lastIndex_ = index;
+
+                return *value == model_[index] || fail("wrong value at " + std::to_string(index));
+            }
+            case CONST_INDEX:
+            {
+                if(size == 0)
+                {
+                    return true;
+                }
+
+                const List& constList = list_;
+                int index = random_index(size - 1);
+                const T* value = nullptr;
+
+                measure(operation, [&]{ value = &constList[index]; });
+
+                return *value == model_[index] || fail("wrong const value at " + std::to_string(index));
+            }
+            case FIND:
+            {
+                // a value that is in the list most of the time
+                T value = size > 0 && random_() % 4 != 0 ? model_[random_index(size - 1)] : next_value();
+                unsigned found = 0;
+
+                measure(operation, [&]{ found = list_.find(value); });
+
+                unsigned expected = static_cast<unsigned>(std::find(model_.begin(), model_.end(), value) - model_.begin());
+
+                return found == expected || fail("find returned " + std::to_string(found) + " instead of " + std::to_string(expected));
+            }
+            case SPLIT_SPLICE:
+            {
+                int index = random_index(size);
+                size_t moved = size - index;
+                int where = random_index(index);
+                size_t splitSize = 0;
+
+                measure(operation, [&]{
+                    List rest = list_.split_at(index);
+
+                    splitSize = rest.size();
+                    list_.splice(where, std::move(rest));
+                });
+
+                std::vector<T> rest(model_.begin() + index, model_.end());
+
+                model_.erase(model_.begin() + index, model_.end());
+                model_.insert(model_.begin() + where, rest.begin(), rest.end());
+
+                return splitSize == moved || fail("split_at moved " + std::to_string(splitSize) + " values instead of " + std::to_string(moved));
+            }
+            case APPEND:
+            {
+                List other = empty_list();
+                int count = static_cast<int>(random_() % (4 * other.node_capacity() + 1));
+
+                for(int i = 0; i < count; ++i)
+                {
+                    T value = next_value();
+
+                    other.push_back(value);
+                    model_.push_back(value);
+                }
+
+                measure(operation, [&]{ list_.append(std::move(other)); });
+
+                return other.size() == 0 || fail("append left values in the other list");
+            }
+            case COPY:
+            {
+                // a copy, then the copy assigned or moved back
+                bool move = random_() % 2 == 0;
+
+                measure(operation, [&]{
+                    List copy(list_);
+
+                    if(move)
+                    {
+                        list_ = std::move(copy);
+                    }
+                    else
+                    {
+                        list_ = copy;
+                    }
+                });
+
+                return true;
+            }
+            case ASSIGN:
+            {
+                std::vector<T> values(random_() % 4096);
+
+                for(T& value : values)
+                {
+                    value = next_value();
+                }
+
+                model_ = values;
+                measure(operation, [&]{ list_.assign(values.begin(), values.end()); });
+
+                return true;
+            }
+            case RESERVE_PUSH:
+            {
+                // with the nodes reserved, pushes at the back don't allocate
+                int count = static_cast<int>(random_() % (4 * list_.node_capacity() + 1));
+                std::vector<T> values(count);
+
+                for(T& value : values)
+                {
+                    value = next_value();
+                }
+
+                model_.insert(model_.end(), values.begin(), values.end());
+
+                // a full tail can leave half of each new node empty when it splits
+                list_.reserve_nodes(list_.stats().nodeCount + 2 * count / list_.node_capacity() + 2);
+
+                size_t before = records_[operation].allocations;
+
+                measure(operation, [&]{
+                    for(T& value : values)
+                    {
+                        list_.push_back(std::move(value));
+                    }
+                });
+
+                size_t made = records_[operation].allocations - before;
+
+                return made == 0 || fail(std::to_string(made) + " allocations after reserve");
+            }
+            case COMPACT_STEP:
+            {
+                int budget = 1 + random_() % 4;
+
+                measure(operation, [&]{ list_.compact_step(budget); });
+
+                return true;
+            }
+            case COMPACT:
+            {
+                measure(operation, [&]{ list_.compact(); });
+
+                // every node but the tail is full
+                int capacity = list_.node_capacity();
+                int nodes = static_cast<int>((model_.size() + capacity - 1) / capacity);
+
+                return list_.stats().nodeCount == nodes || fail("compact left " + std::to_string(list_.stats().nodeCount) + " nodes instead of " + std::to_string(nodes));
+            }
+            case INSERT_SORTED:
+            {
+                if(sortedModel_.size() > SORTED_LIMIT)
+                {
+                    sorted_.erase(0, static_cast<int>(sortedModel_.size() / 2));
+                    sortedModel_.erase(sortedModel_.begin(), sortedModel_.begin() + sortedModel_.size() / 2);
+                }
+
+                T value = next_value();
+                unsigned index = 0;
+
+                measure(operation, [&]{ index = sorted_.insert_sorted(value); });
+
+                auto expected = std::upper_bound(sortedModel_.begin(), sortedModel_.end(), value);
+                unsigned expectedIndex = static_cast<unsigned>(expected - sortedModel_.begin());
+
+                sortedModel_.insert(expected, value);
+
+                return index == expectedIndex || fail("insert_sorted returned " + std::to_string(index) + " instead of " + std::to_string(expectedIndex));
+            }
+            case LOWER_BOUND:
+            {
+                T value = next_value();
+                unsigned index = 0;
+
+                measure(operation, [&]{ index = sorted_.lower_bound(value); });
+
+                unsigned expected = static_cast<unsigned>(std::lower_bound(sortedModel_.begin(), sortedModel_.end(), value) - sortedModel_.begin());
+
+                return index == expected || fail("lower_bound returned " + std::to_string(index) + " instead of " + std::to_string(expected));
+            }
+            case BAD_INDEX:
+            {
+                // one past the end is not a value, nothing is erased
+                int code = -1;
+
+                measure(operation, [&]{
+                    try
+                    {
+                        list_.erase(static_cast<int>(size));
+                    }
+                    catch(const LariatException& e)
+                    {
+                        code = e.code();
+                    }
+                });
+
+                return code == LariatException::E_BAD_INDEX || fail("erase(size) didn't throw E_BAD_INDEX");
+            }
+            case SET_POLICY:
+            {
+                LariatSplitPolicy policy = static_cast<LariatSplitPolicy>(random_() % 3);
+                int threshold = static_cast<int>(random_() % 3) * list_.node_capacity() / 4;
+
+                measure(operation, [&]{
+                    list_.set_split_policy(policy);
+                    list_.set_merge_threshold(threshold);
+                });
+
+                return true;
+            }
+            case APPENDER:
+            {
+                // values written straight into the windows mixed with pushes, one flush per node
+                int count = static_cast<int>(random_() % (3 * list_.node_capacity() + 1));
+                std::vector<T> values;
+
+                for(int i = 0; i < count; ++i)
+                {
+                    values.push_back(next_value());
+                }
+
+                model_.insert(model_.end(), values.begin(), values.end());
+
+                measure(operation, [&]{
+                    typename List::Appender appender = list_.appender();
+
+                    for(int i = 0; i < count; )
+                    {
+                        if(random_() % 2 == 0)
+                        {
+                            appender.push(std::move(values[i++]));
+
+                            continue;
+                        }
+
+                        int room = 0;
+                        T* slots = appender.window(room);
+                        int written = std::min(room, count - i);
+
+                        for(int j = 0; j < written; ++j)
+                        {
+                            new (slots + j) T(std::move(values[i++]));
+                        }
+
+                        appender.commit(written);
+                    }
+                });
+
+                return model_.empty() || list_.last() == model_.back() || fail("wrong last value");
+            }
+            case SAVE_LOAD:
+            {
+                // snapshots only hold trivially copyable values
+                if constexpr(std::is_trivially_copyable<T>::value)
+                {
+                    std::string path = snapshot_path();
+                    List loaded = empty_list();
+
+                    measure(operation, [&]{
+                        list_.save(path);
+                        loaded.load(path);
+                    });
+
+                    std::remove(path.c_str());
+
+                    if(!std::equal(loaded.begin(), loaded.end(), model_.begin(), model_.end()))
+                    {
+                        return fail("the loaded list differs");
+                    }
+
+                    // load fills every node, carry on with that list
+                    int capacity = loaded.node_capacity();
+                    int nodes = static_cast<int>((model_.size() + capacity - 1) / capacity);
+
+                    if(loaded.stats().nodeCount != nodes)
+                    {
+                        return fail("load made " + std::to_string(loaded.stats().nodeCount) + " nodes instead of " + std::to_string(nodes));
+                    }
+
+                    loaded.set_split_policy(list_.split_policy());
+                    loaded.set_merge_threshold(list_.merge_threshold());
+
+                    list_ = std::move(loaded);
+                }
+
+                return true;
+            }
+            case VIEW:
+            {
+                if constexpr(std::is_trivially_copyable<T>::value)
+                {
+                    std::string path = snapshot_path();
+
+                    list_.save(path);
+
+                    LariatView<T> view;
+
+                    measure(operation, [&]{ view.open(path); });
+
+                    bool same = view.size() == model_.size() && std::equal(view.begin(), view.end(), model_.begin(), model_.end());
+                    unsigned found = 0;
+                    unsigned expected = 0;
+
+                    if(same && size > 0)
+                    {
+                        T value = model_[random_index(size - 1)];
+
+                        found = view.find(value);
+                        expected = static_cast<unsigned>(std::find(model_.begin(), model_.end(), value) - model_.begin());
+                        same = view[static_cast<int>(expected)] == value && view.first() == model_.front() && view.last() == model_.back();
+                    }
+
+                    view.close();
+                    std::remove(path.c_str());
+
+                    if(!same)
+                    {
+                        return fail("the view differs");
+                    }
+
+                    return found == expected || fail("view find returned " + std::to_string(found) + " instead of " + std::to_string(expected));
+                }
+
+                return true;
+            }
+            case PARALLEL_FIND:
+            {
+                T value = size > 0 && random_() % 4 != 0 ? model_[random_index(size - 1)] : next_value();
+                unsigned threads = random_() % 5;
+                unsigned found = 0;
+
+                measure(operation, [&]{ found = parallel_find(list_, value, threads); });
+
+                unsigned expected = static_cast<unsigned>(std::find(model_.begin(), model_.end(), value) - model_.begin());
+
+                return found == expected || fail("parallel_find returned " + std::to_string(found) + " instead of " + std::to_string(expected));
+            }
+            case PARALLEL_COUNT_IF:
+            {
+                size_t divisor = 1 + random_() % 8;
+                unsigned threads = random_() % 5;
+                size_t counted = 0;
+
+                auto predicate = [divisor](const T& value) { return std::hash<T>()(value) % divisor == 0; };
+
+                measure(operation, [&]{ counted = parallel_count_if(list_, predicate, threads); });
+
+                size_t expected = static_cast<size_t>(std::count_if(model_.begin(), model_.end(), predicate));
+
+                return counted == expected || fail("parallel_count_if counted " + std::to_string(counted) + " instead of " + std::to_string(expected));
+            }
+            case DUMP:
+            {
+                std::ostringstream dumped;
+                std::ostringstream expected;
+
+                measure(operation, [&]{ list_.dump(dumped, DUMP_VALUES); });
+
+                for(const T& value : model_)
+                {
+                    expected << value << '\n';
+                }
+
+                return dumped.str() == expected.str() || fail("dump differs from writing each value");
+            }
+            default:
+                return true;
+        }
+    }
+
+    /**
+     * @brief checks every value of the list against the vector, forward, backward and
+     *        through a const list, and checks the node statistics agree with the size
+     *
+     * @return - false if anything differs
+     */
+    template<typename T, int Size>
+    bool Stress<T, Size>::check_all()
+    {
+        size_t index = 0;
+
+        for(const T& value : list_)
+        {
+            if(index >= model_.size() || !(value == model_[index]))
+            {
+                return fail("iteration differs at " + std::to_string(index));
+            }
+
+            index++;
+        }
+
+        if(index != model_.size())
+        {
+            return fail("iteration ended at " + std::to_string(index));
+        }
+
+        for(auto it = list_.rbegin(); it != list_.rend(); ++it)
+        {
+            if(!(*it == model_[--index]))
+            {
+                return fail("reverse iteration differs at " + std::to_string(index));
+            }
+        }
+
+        const List& constList = list_;
+
+        // a stride that doesn't take from the random sequence, so a seed repeats with any check interval
+        for(size_t i = 0; i < model_.size(); i += 1 + (i * 31 + stepIndex_) % 64)
+        {
+            if(!(constList[static_cast<int>(i)] == model_[i]))
+            {
+                return fail("const operator[] differs at " + std::to_string(i));
+            }
+        }
+
+        if(!std::equal(sorted_.begin(), sorted_.end(), sortedModel_.begin(), sortedModel_.end()))
+        {
+            return fail("sorted list differs");
+        }
+
+        LariatStats stats = list_.stats();
+        size_t histogramNodes = 0;
+
+        for(size_t nodes : stats.fillHistogram)
+        {
+            histogramNodes += nodes;
+        }
+
+        if(stats.size != model_.size() || histogramNodes != static_cast<size_t>(stats.nodeCount) ||
+           static_cast<size_t>(stats.nodeCount) * stats.nodeCapacity < stats.size)
+        {
+            return fail("stats don't match the list");
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief prints where the test failed
+     *
+     * @param what - what was wrong
+     * @return - false, so a check can return it
+     */
+    template<typename T, int Size>
+    bool Stress<T, Size>::fail(const std::string& what)
+    {
+        std::cerr << name_ << ", seed " << seed_ << ", operation " << stepIndex_ << " (" << operationNames[current_] << "): " << what << "\n";
+
+        return false;
+    }
+
+    /**
+     * @brief prints the node counters and, for each operation type, how often it ran, the
+     *        heap allocations it made and its median and 99th percentile latency
+     */
+    template<typename T, int Size>
+    void Stress<T, Size>::report() const
+    {
+        LariatStats stats = list_.stats();
+
+        std::cout << name_ << ", seed " << seed_ << ": " << list_.size() << " values in " << stats.nodeCount << " nodes";
+
+#ifdef LARIAT_STATS
+        std::cout << ", " << stats.nodeAllocations << " node allocations, " << stats.nodeFrees << " node frees, "
+                  << stats.splits << " splits, " << stats.shiftMoves << " shift moves";
+#endif
+
+        std::cout << "\n" << std::left << std::setw(24) << "  operation" << std::right << std::setw(10) << "count"
+                  << std::setw(12) << "allocs/op" << std::setw(10) << "p50 ns" << std::setw(10) << "p99 ns" << "\n";
+
+        for(int operation = 0; operation < OPERATIONS; ++operation)
+        {
+            std::vector<uint32_t> nanoseconds = records_[operation].nanoseconds;
+
+            if(nanoseconds.empty())
+            {
+                continue;
+            }
+
+            std::sort(nanoseconds.begin(), nanoseconds.end());
+
+            std::cout << "  " << std::left << std::setw(22) << operationNames[operation] << std::right
+                      << std::setw(10) << nanoseconds.size()
+                      << std::setw(12) << std::fixed << std::setprecision(3) << static_cast<double>(records_[operation].allocations) / nanoseconds.size()
+                      << std::setw(10) << nanoseconds[nanoseconds.size() / 2]
+                      << std::setw(10) << nanoseconds[nanoseconds.size() * 99 / 100] << "\n";
+        }
+
+        std::cout << "\n";
+    }
+
+    /**
+     * @brief returns an empty list of the type under test
+     */
+    template<typename T, int Size>
+    typename Stress<T, Size>::List Stress<T, Size>::empty_list() const
+    {
+        if constexpr(Size == LARIAT_DYNAMIC_SIZE)
+        {
+            return List(nodeCapacity_);
+        }
+        else
+        {
+            return List();
+        }
+    }
+
+    /**
+     * @brief returns the path of the file the snapshot operations write, in the temp directory
+     */
+    template<typename T, int Size>
+    std::string Stress<T, Size>::snapshot_path() const
+    {
+        return (std::filesystem::temp_directory_path() / ("lariat_stress_" + std::to_string(seed_) + ".bin")).string();
+    }
+
+    /**
+     * @brief returns a random value
+     */
+    template<typename T, int Size>
+    T Stress<T, Size>::next_value()
+    {
+        return make_value<T>(random_());
+    }
+
+    /**
+     * @brief returns a random index from 0 to size, both included
+     *
+     * @param size - largest index
+     */
+    template<typename T, int Size>
+    int Stress<T, Size>::random_index(size_t size)
+    {
+        return static_cast<int>(random_() % (size + 1));
+    }
+
+    /**
+     * @brief calls a function, recording how long it took and how many allocations it made
+     *        for an operation
+     *
+     * @param operation - operation the call is
+     * @param function - the call
+     */
+    template<typename T, int Size>
+    template<typename Function>
+    void Stress<T, Size>::measure(Operation operation, Function function)
+    {
+        size_t allocationsBefore = allocations;
+        Clock::time_point start = Clock::now();
+
+        function();
+
+        Clock::time_point end = Clock::now();
+
+        records_[operation].allocations += allocations - allocationsBefore;
+        records_[operation].nanoseconds.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+
+    template<typename T, int Size>
+    bool run_stress(const std::string& name, unsigned seed, int operations, int nodeCapacity = 0)
+    {
+        Stress<T, Size> stress(name, seed, nodeCapacity);
+
+        if(!stress.run(operations))
+        {
+            return false;
+        }
+
+        stress.report();
+
+        return true;
+    }
+
+    /**
+     * @brief prints what went wrong in the threaded section
+     *
+     * @param what - what was wrong
+     * @return - false, so a check can return it
+     */
+    bool threaded_fail(const std::string& what)
+    {
+        std::cerr << "threaded: " << what << "\n";
+
+        return false;
+    }
+
+    /**
+     * @brief prints how long a part of the threaded section took
+     *
+     * @param name - the part
+     * @param start - when it started
+     */
+    void threaded_report(const std::string& name, Clock::time_point start)
+    {
+        std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+
+        std::cout << "  " << std::left << std::setw(36) << name << std::right << std::setw(10) << std::fixed << std::setprecision(1) << elapsed.count() << " ms\n";
+    }
+
+    /**
+     * @brief a producer thread pushes sequenced values through a queue of small nodes and
+     *        the consumer checks it pops each one once and in order
+     */
+    bool threaded_queue()
+    {
+        Clock::time_point start = Clock::now();
+        LariatQueue<int, 16> queue;
+
+        std::thread producer([&]
+        {
+            for(int i = 0; i < THREADED_VALUES; ++i)
+            {
+                queue.push(i);
+            }
+        });
+
+        int expected = 0;
+        int wrong = 0;
+
+        while(expected < THREADED_VALUES)
+        {
+            int value = 0;
+
+            if(!queue.try_pop(value))
+            {
+                std::this_thread::yield();
+
+                continue;
+            }
+
+            wrong += value != expected++;
+        }
+
+        producer.join();
+
+        threaded_report("LariatQueue, 1 producer 1 consumer", start);
+
+        if(wrong > 0)
+        {
+            return threaded_fail("LariatQueue popped " + std::to_string(wrong) + " values out of order");
+        }
+
+        return queue.empty() || threaded_fail("LariatQueue isn't empty after popping every value");
+    }
+
+    /**
+     * @brief a producer thread pushes sequenced values on the back of a concurrent lariat
+     *        while the consumer takes half of them off the front, checking they come off in
+     *        order. The other half must be left, in order
+     */
+    bool threaded_concurrent()
+    {
+        Clock::time_point start = Clock::now();
+        ConcurrentLariat<int, 16> list;
+
+        std::thread producer([&]
+        {
+            for(int i = 0; i < THREADED_VALUES; ++i)
+            {
+                list.push_back(i);
+            }
+        });
+
+        int expected = 0;
+        int wrong = 0;
+
+        while(expected < THREADED_VALUES / 2)
+        {
+            if(list.size() == 0)
+            {
+                std::this_thread::yield();
+
+                continue;
+            }
+
+            // only this thread erases, so the front stays the front between the calls
+            int value = list.get(0);
+
+            wrong += value != expected || list.find(value) != 0;
+
+            list.erase(0);
+            expected++;
+
+            // erases leave empty nodes in the chain until a compact
+            if(expected % 256 == 0)
+            {
+                list.compact();
+            }
+        }
+
+        producer.join();
+
+        threaded_report("ConcurrentLariat, push_back + erase", start);
+
+        if(wrong > 0)
+        {
+            return threaded_fail("ConcurrentLariat took " + std::to_string(wrong) + " values off the front out of order");
+        }
+
+        if(list.size() != static_cast<size_t>(THREADED_VALUES - expected))
+        {
+            return threaded_fail("ConcurrentLariat has " + std::to_string(list.size()) + " values left");
+        }
+
+        for(int i = 0; i < THREADED_VALUES - expected; ++i)
+        {
+            if(list.get(i) != expected + i)
+            {
+                return threaded_fail("ConcurrentLariat holds " + std::to_string(list.get(i)) + " at " + std::to_string(i));
+            }
+        }
+
+        return list.find(-1) == ConcurrentLariat<int, 16>::NOT_FOUND || threaded_fail("ConcurrentLariat found a value it doesn't hold");
+    }
+
+    /**
+     * @brief the parallel scans on a list long enough to use several threads
+     */
+    bool threaded_scans()
+    {
+        Clock::time_point start = Clock::now();
+        std::vector<int> model(16 * THREADED_VALUES);
+
+        for(size_t i = 0; i < model.size(); ++i)
+        {
+            model[i] = make_value<int>(static_cast<unsigned>(i * 2654435761u));
+        }
+
+        Lariat<int, 64> list(model.begin(), model.end());
+
+        for(unsigned threads : { 2u, 4u, 0u })
+        {
+            // a value in the last part, one in the first and one that isn't there
+            for(int value : { model[model.size() - 7], model[3], -1 })
+            {
+                unsigned expected = static_cast<unsigned>(std::find(model.begin(), model.end(), value) - model.begin());
+
+                if(parallel_find(list, value, threads) != expected)
+                {
+                    return threaded_fail("parallel_find of " + std::to_string(value) + " on " + std::to_string(threads) + " threads");
+                }
+            }
+
+            auto odd = [](int value) { return value % 2 != 0; };
+
+            if(parallel_count_if(list, odd, threads) != static_cast<size_t>(std::count_if(model.begin(), model.end(), odd)))
+            {
+                return threaded_fail("parallel_count_if on " + std::to_string(threads) + " threads");
+            }
+
+            parallel_for_each(list, [](int& value) { value++; }, threads);
+
+            for(int& value : model)
+            {
+                value++;
+            }
+
+            if(!std::equal(list.begin(), list.end(), model.begin(), model.end()))
+            {
+                return threaded_fail("parallel_for_each on " + std::to_string(threads) + " threads");
+            }
+        }
+
+        threaded_report("parallel scans", start);
+
+        return true;
+    }
+
+    /**
+     * @brief the parts of the library that run on several threads, with fixed sequences
+     *        so a failure repeats
+     */
+    bool run_threaded()
+    {
+        std::cout << "threaded\n";
+
+        bool passed = threaded_queue() && threaded_concurrent() && threaded_scans();
+
+        std::cout << "\n";
+
+        return passed;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int operations = argc > 1 ? std::atoi(argv[1]) : 100000;
+    unsigned seed = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 1;
+
+    bool passed = run_stress<int, 2>("Lariat<int, 2>", seed, operations) &&
+                  run_stress<int, 4>("Lariat<int, 4>", seed, operations) &&
+                  run_stress<int, 64>("Lariat<int, 64>", seed, operations) &&
+                  run_stress<std::string, 8>("Lariat<std::string, 8>", seed, operations) &&
+                  run_stress<int, LARIAT_DYNAMIC_SIZE>("Lariat<int, LARIAT_DYNAMIC_SIZE>(16)", seed, operations, 16) &&
+                  run_stress<int, lariat_page_capacity<int>()>("Lariat<int>", seed, operations) &&
+                  run_threaded();
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}